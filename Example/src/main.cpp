@@ -57,7 +57,7 @@ int main()
         windowConfig.width      = SCREEN_WIDTH;
         windowConfig.height     = SCREEN_HEIGHT;
         windowConfig.title      = "Boat Example - ECS Framework";
-        windowConfig.vsync      = true;
+        windowConfig.vsync      = false;  // FramePacer paces to frameLimit
         windowConfig.frameLimit = 144;
 
         logFile << "Creating GameEngine...\n";
@@ -77,6 +77,10 @@ int main()
         // Set up Box2D physics world (gravity disabled)
         engine.getPhysics().setGravity({0.0f, 0.0f});
 
+        // Decode sprite textures on job workers while the scene is set up
+        engine.getRenderer().preloadTexture("assets/textures/boat.png");
+        engine.getRenderer().preloadTexture("assets/textures/barrel.png");
+
         logFile << "Creating entities...\n";
         logFile.flush();
 
@@ -91,8 +95,7 @@ int main()
         logFile << "Game initialized successfully!\n";
         logFile.flush();
 
-        sf::Clock clock;
-        clock.restart();
+        FramePacer& pacer = engine.getFramePacer();
 
         auto* window = engine.getRenderer().getWindow();
 
@@ -114,18 +117,17 @@ int main()
 
             if (frameCount % 60 == 0)
             {
-                logFile << "Reached frame " << frameCount << "\n";
+                logFile << "Reached frame " << frameCount << " (missed deadlines: " << pacer.getMissedDeadlines() << ")\n";
                 logFile.flush();
             }
 
-            logFile << "  Getting delta time...\n";
+            logFile << "  Waiting for frame deadline...\n";
             logFile.flush();
-            const float dt     = clock.restart().asSeconds();
-            const float safeDt = (dt < 0.001f) ? 0.016f : dt;  // Use 60 FPS default if dt is too small
+            const float dt = pacer.waitForNextFrame();
 
-            logFile << "  Calling engine.update(" << safeDt << ")...\n";
+            logFile << "  Calling engine.update(" << dt << ")...\n";
             logFile.flush();
-            engine.update(safeDt);
+            engine.update(dt);
 
             logFile << "  Calling engine.render()...\n";
             logFile.flush();
@@ -136,6 +138,7 @@ int main()
         }
 
         logFile << "Main loop exited after " << frameCount << " frames\n";
+        logFile << "Missed frame deadlines: " << pacer.getMissedDeadlines() << "\n";
         logFile << "Engine is running: " << (engine.is_running() ? "yes" : "no") << "\n";
         if (window)
         {
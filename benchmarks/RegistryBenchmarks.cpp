@@ -0,0 +1,208 @@
+#include <benchmark/benchmark.h>
+
+#include <Registry.h>
+#include <World.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+struct Position
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct Velocity
+{
+    float x = 1.0f;
+    float y = 1.0f;
+};
+
+std::vector<Entity> createEntities(Registry& registry, size_t count)
+{
+    std::vector<Entity> entities;
+    entities.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        entities.push_back(registry.createEntity());
+    }
+    return entities;
+}
+
+void shuffle(std::vector<Entity>& entities)
+{
+    std::mt19937 rng(1234);
+    std::shuffle(entities.begin(), entities.end(), rng);
+}
+
+void entityCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+}
+}  // namespace
+
+static void BM_RegistryAdd(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto                registry = std::make_unique<Registry>();
+        std::vector<Entity> entities = createEntities(*registry, count);
+        state.ResumeTiming();
+
+        for (Entity entity : entities)
+        {
+            benchmark::DoNotOptimize(registry->add<Position>(entity));
+        }
+
+        state.PauseTiming();
+        registry.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_RegistryAdd)->Apply(entityCounts);
+
+static void BM_RegistryRemove(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto                registry = std::make_unique<Registry>();
+        std::vector<Entity> entities = createEntities(*registry, count);
+        for (Entity entity : entities)
+        {
+            registry->add<Position>(entity);
+        }
+        shuffle(entities);
+        state.ResumeTiming();
+
+        for (Entity entity : entities)
+        {
+            registry->remove<Position>(entity);
+        }
+
+        state.PauseTiming();
+        registry.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_RegistryRemove)->Apply(entityCounts);
+
+static void BM_RegistryGetRandom(benchmark::State& state)
+{
+    const size_t        count = static_cast<size_t>(state.range(0));
+    Registry            registry;
+    std::vector<Entity> entities = createEntities(registry, count);
+    for (Entity entity : entities)
+    {
+        registry.add<Position>(entity);
+    }
+    shuffle(entities);
+
+    for (auto _ : state)
+    {
+        for (Entity entity : entities)
+        {
+            benchmark::DoNotOptimize(registry.get<Position>(entity));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_RegistryGetRandom)->Apply(entityCounts);
+
+static void BM_RegistryView2(benchmark::State& state)
+{
+    const size_t        count    = static_cast<size_t>(state.range(0));
+    Registry            registry;
+    std::vector<Entity> entities = createEntities(registry, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        registry.add<Position>(entities[i]);
+        // Half the entities move, so the view has to skip non-matching entries
+        if (i % 2 == 0)
+        {
+            registry.add<Velocity>(entities[i]);
+        }
+    }
+
+    for (auto _ : state)
+    {
+        registry.view<Position, Velocity>(
+            [](Entity, Position& position, Velocity& velocity)
+            {
+                position.x += velocity.x;
+                position.y += velocity.y;
+            });
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_RegistryView2)->Apply(entityCounts);
+
+static void BM_RegistryViewSorted(benchmark::State& state)
+{
+    const size_t        count    = static_cast<size_t>(state.range(0));
+    Registry            registry;
+    std::vector<Entity> entities = createEntities(registry, count);
+
+    // Adding in random order leaves the dense array unsorted by entity
+    shuffle(entities);
+    for (Entity entity : entities)
+    {
+        registry.add<Position>(entity);
+    }
+
+    for (auto _ : state)
+    {
+        registry.viewSorted<Position>([](Entity, Position& position) { benchmark::DoNotOptimize(position); });
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_RegistryViewSorted)->Apply(entityCounts);
+
+static void BM_CommandBufferFlush(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto                world    = std::make_unique<World>();
+        std::vector<Entity> entities;
+        entities.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Entity entity = world->createEntity();
+            world->queueAdd<Position>(entity);
+            entities.push_back(entity);
+        }
+        state.ResumeTiming();
+
+        // Applies count adds, then count destroys
+        world->flushCommandBuffer();
+        world->queueDestroyBatch(entities);
+        world->flushCommandBuffer();
+
+        state.PauseTiming();
+        world.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count * 2));
+}
+BENCHMARK(BM_CommandBufferFlush)->Apply(entityCounts);
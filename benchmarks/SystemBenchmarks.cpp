@@ -0,0 +1,184 @@
+#include <benchmark/benchmark.h>
+
+#include <World.h>
+
+#include <components/CParticleEmitter.h>
+#include <components/CPhysicsBody2D.h>
+#include <components/CRenderable.h>
+#include <components/CTransform.h>
+#include <systems/S2DPhysics.h>
+#include <systems/SParticle.h>
+#include <systems/SRenderer.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr int kParticlesPerEmitter = 1000;
+
+/**
+ * @brief Spreads count entities with a CTransform over a grid one meter apart
+ */
+std::vector<Entity> createGrid(World& world, size_t count)
+{
+    std::vector<Entity> entities;
+    entities.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        Entity entity = world.createEntity();
+        world.add<Components::CTransform>(entity,
+                                          Vec2(static_cast<float>(i % 1000), static_cast<float>(i / 1000)),
+                                          Vec2(1.0f, 1.0f),
+                                          0.0f);
+        entities.push_back(entity);
+    }
+    return entities;
+}
+
+/**
+ * @brief Emitters filled to kParticlesPerEmitter long-lived particles that no longer spawn
+ */
+void createFullEmitters(World& world, Systems::SParticle& particles, size_t particleCount)
+{
+    const size_t emitterCount = std::max<size_t>(1, particleCount / kParticlesPerEmitter);
+    for (Entity entity : createGrid(world, emitterCount))
+    {
+        auto* emitter = world.add<Components::CParticleEmitter>(entity);
+        emitter->setMaxParticles(kParticlesPerEmitter);
+        emitter->setEmissionRate(static_cast<float>(kParticlesPerEmitter));
+        emitter->setMinLifetime(1.0e6f);
+        emitter->setMaxLifetime(1.0e6f);
+    }
+
+    particles.update(1.0f, world);
+
+    world.components().each<Components::CParticleEmitter>([](Entity, Components::CParticleEmitter& emitter)
+                                                          { emitter.setEmissionRate(0.0f); });
+}
+
+/**
+ * @brief Renderer with a real window, or nullptr where no window can be opened
+ */
+Systems::SRenderer* sharedRenderer()
+{
+    static std::unique_ptr<Systems::SRenderer> renderer = []() -> std::unique_ptr<Systems::SRenderer>
+    {
+#if defined(__linux__)
+        // SFML aborts the process when it cannot reach a display server
+        if (!std::getenv("DISPLAY") && !std::getenv("WAYLAND_DISPLAY"))
+        {
+            return nullptr;
+        }
+#endif
+        Systems::WindowConfig config;
+        config.vsync = false;
+
+        auto created = std::make_unique<Systems::SRenderer>();
+        return created->initialize(config) ? std::move(created) : nullptr;
+    }();
+    return renderer.get();
+}
+}  // namespace
+
+static void BM_S2DPhysicsSyncAndStep(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    World               world;
+    Systems::S2DPhysics physics;
+    physics.bindWorld(&world);
+    physics.setGravity({0.0f, 0.0f});
+
+    for (Entity entity : createGrid(world, count))
+    {
+        world.add<Components::CPhysicsBody2D>(entity);
+    }
+
+    // The first update creates every body; measure the steady-state transform sync passes and step
+    physics.update(physics.getTimeStep(), world);
+
+    for (auto _ : state)
+    {
+        physics.update(physics.getTimeStep(), world);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_S2DPhysicsSyncAndStep)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_SParticleUpdate(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    World              world;
+    Systems::SParticle particles;
+    particles.initialize(nullptr);
+    createFullEmitters(world, particles, count);
+
+    for (auto _ : state)
+    {
+        particles.update(1.0f / 60.0f, world);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_SParticleUpdate)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_SParticleBuildVertices(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    World              world;
+    Systems::SParticle particles;
+    particles.initialize(nullptr);
+    createFullEmitters(world, particles, count);
+
+    std::vector<Entity> emitters;
+    world.components().each<Components::CParticleEmitter>([&emitters](Entity entity, Components::CParticleEmitter&)
+                                                          { emitters.push_back(entity); });
+
+    sf::VertexArray vertices;
+    for (auto _ : state)
+    {
+        for (Entity entity : emitters)
+        {
+            benchmark::DoNotOptimize(particles.buildEmitterVertices(entity, world, vertices));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_SParticleBuildVertices)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_SRendererBuildFrame(benchmark::State& state)
+{
+    Systems::SRenderer* renderer = sharedRenderer();
+    if (!renderer)
+    {
+        state.SkipWithError("No display available for the render window");
+        return;
+    }
+
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    World world;
+    int   zIndex = 0;
+    for (Entity entity : createGrid(world, count))
+    {
+        // Cycle through a handful of layers so the queue sort has real work to do
+        world.add<Components::CRenderable>(entity, Components::VisualType::Rectangle, Color::White, zIndex++ % 8);
+    }
+
+    Systems::RenderFrame frame;
+    for (auto _ : state)
+    {
+        renderer->buildFrame(world, 1.0f, frame);
+        benchmark::DoNotOptimize(frame.vertices.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_SRendererBuildFrame)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
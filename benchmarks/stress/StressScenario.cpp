@@ -0,0 +1,477 @@
+/**
+ * @file StressScenario.cpp
+ * @brief Headless stress scenario: steps a deterministic, scaled-up world and checks frame budgets
+ *
+ * Builds a world of falling barrels inside a walled pit, particle emitters and native
+ * scripts, steps it without a window and reports frame-time percentiles, a per-system
+ * breakdown, peak memory and heap allocation counts. Exits with 1 when a budget passed
+ * on the command line is exceeded and 2 on invalid arguments.
+ *
+ * Example:
+ *     stress_scenario --barrels 10000 --emitters 100 --scripts 2000 --frames 600 --budget-p99-ms 16.6
+ */
+
+#include <GameEngine.h>
+#include <Profiler.h>
+
+#include <components/CCollider2D.h>
+#include <components/CNativeScript.h>
+#include <components/CParticleEmitter.h>
+#include <components/CPhysicsBody2D.h>
+#include <components/CRenderable.h>
+#include <components/CTransform.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Allocation counting: every global operator new in the process goes through here
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+std::atomic<uint64_t> g_allocationCount{0};
+std::atomic<uint64_t> g_allocatedBytes{0};
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size > 0 ? size : 1))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept
+{
+    std::free(pointer);
+}
+
+namespace
+{
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Configuration
+// ─────────────────────────────────────────────────────────────────────────────
+
+struct ScenarioConfig
+{
+    size_t   barrels      = 10000;  ///< Dynamic circle bodies dropped into the pit
+    size_t   emitters     = 50;     ///< Particle emitters spread over the pit
+    size_t   scripts      = 1000;   ///< Entities running a native script every frame
+    size_t   frames       = 600;    ///< Measured frames
+    size_t   warmupFrames = 60;     ///< Frames stepped before measuring
+    size_t   workers      = 0;      ///< Job system workers (0 = hardware threads - 1)
+    uint32_t seed         = 1;      ///< Seed for every random placement
+
+    // Budgets; negative values are not checked
+    double budgetP99Ms          = -1.0;  ///< 99th percentile frame time
+    double budgetPeakMb         = -1.0;  ///< Peak resident memory of the process
+    double budgetAllocsPerFrame = -1.0;  ///< Mean heap allocations per measured frame
+};
+
+void printUsage(const char* program)
+{
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --barrels N                 Dynamic barrels (default 10000)\n"
+        "  --emitters N                Particle emitters (default 50)\n"
+        "  --scripts N                 Scripted entities (default 1000)\n"
+        "  --frames N                  Measured frames (default 600)\n"
+        "  --warmup N                  Unmeasured frames first (default 60)\n"
+        "  --workers N                 Job system workers (default: hardware threads - 1)\n"
+        "  --seed N                    Placement seed (default 1)\n"
+        "  --budget-p99-ms X           Fail if p99 frame time exceeds X ms\n"
+        "  --budget-peak-mb X          Fail if peak resident memory exceeds X MiB\n"
+        "  --budget-allocs-per-frame X Fail if mean allocations per frame exceed X\n",
+        program);
+}
+
+bool parseArguments(int argc, char** argv, ScenarioConfig& config)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* name = argv[i];
+        if (std::strcmp(name, "--help") == 0 || std::strcmp(name, "-h") == 0)
+        {
+            return false;
+        }
+        if (i + 1 >= argc)
+        {
+            std::fprintf(stderr, "Missing value for %s\n", name);
+            return false;
+        }
+
+        const char*  value  = argv[++i];
+        char*        end    = nullptr;
+        const double number = std::strtod(value, &end);
+        if (end == value || *end != '\0' || number < 0.0)
+        {
+            std::fprintf(stderr, "Invalid value '%s' for %s\n", value, name);
+            return false;
+        }
+
+        const auto count = static_cast<size_t>(number);
+        if (std::strcmp(name, "--barrels") == 0)
+        {
+            config.barrels = count;
+        }
+        else if (std::strcmp(name, "--emitters") == 0)
+        {
+            config.emitters = count;
+        }
+        else if (std::strcmp(name, "--scripts") == 0)
+        {
+            config.scripts = count;
+        }
+        else if (std::strcmp(name, "--frames") == 0)
+        {
+            config.frames = std::max<size_t>(1, count);
+        }
+        else if (std::strcmp(name, "--warmup") == 0)
+        {
+            config.warmupFrames = count;
+        }
+        else if (std::strcmp(name, "--workers") == 0)
+        {
+            config.workers = count;
+        }
+        else if (std::strcmp(name, "--seed") == 0)
+        {
+            config.seed = static_cast<uint32_t>(count);
+        }
+        else if (std::strcmp(name, "--budget-p99-ms") == 0)
+        {
+            config.budgetP99Ms = number;
+        }
+        else if (std::strcmp(name, "--budget-peak-mb") == 0)
+        {
+            config.budgetPeakMb = number;
+        }
+        else if (std::strcmp(name, "--budget-allocs-per-frame") == 0)
+        {
+            config.budgetAllocsPerFrame = number;
+        }
+        else
+        {
+            std::fprintf(stderr, "Unknown option %s\n", name);
+            return false;
+        }
+    }
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Scenario world
+// ─────────────────────────────────────────────────────────────────────────────
+
+constexpr float kPitHalfWidth = 60.0f;  ///< Meters from the center to either wall
+constexpr float kPitHeight    = 400.0f;
+constexpr float kBarrelRadius = 0.4f;
+
+/**
+ * @brief Bobs its entity up and down, touching its transform every update like gameplay code
+ */
+class StressScript final : public Components::INativeScript
+{
+public:
+    explicit StressScript(float phase) : m_phase(phase) {}
+
+    void onUpdate(float deltaTime, Entity self, World& world) override
+    {
+        m_phase += deltaTime;
+        if (auto* transform = world.components().tryGet<Components::CTransform>(self))
+        {
+            Vec2 position = transform->getPosition();
+            position.y += std::sin(m_phase * 2.0f) * deltaTime;
+            transform->setPosition(position);
+        }
+    }
+
+private:
+    float m_phase;
+};
+
+void addStaticBox(World& world, const Vec2& center, float halfWidth, float halfHeight)
+{
+    Entity entity = world.createEntity();
+    world.add<Components::CTransform>(entity, center, Vec2(1.0f, 1.0f), 0.0f);
+
+    auto* body     = world.add<Components::CPhysicsBody2D>(entity);
+    body->bodyType = Components::BodyType::Static;
+
+    auto* collider = world.add<Components::CCollider2D>(entity);
+    collider->createBox(halfWidth, halfHeight);
+}
+
+void buildScenario(World& world, const ScenarioConfig& config)
+{
+    std::mt19937                          rng(config.seed);
+    std::uniform_real_distribution<float> x(-kPitHalfWidth + 1.0f, kPitHalfWidth - 1.0f);
+    std::uniform_real_distribution<float> y(2.0f, kPitHeight);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    addStaticBox(world, Vec2(0.0f, -1.0f), kPitHalfWidth + 1.0f, 1.0f);
+    addStaticBox(world, Vec2(-kPitHalfWidth - 0.5f, kPitHeight * 0.5f), 0.5f, kPitHeight * 0.5f);
+    addStaticBox(world, Vec2(kPitHalfWidth + 0.5f, kPitHeight * 0.5f), 0.5f, kPitHeight * 0.5f);
+
+    for (size_t i = 0; i < config.barrels; ++i)
+    {
+        Entity barrel = world.createEntity();
+        world.add<Components::CTransform>(barrel, Vec2(x(rng), y(rng)), Vec2(1.0f, 1.0f), 0.0f);
+        world.add<Components::CRenderable>(barrel, Components::VisualType::Circle, Color::White, 1);
+        world.add<Components::CPhysicsBody2D>(barrel);
+
+        auto* collider = world.add<Components::CCollider2D>(barrel);
+        collider->createCircle(kBarrelRadius);
+    }
+
+    for (size_t i = 0; i < config.emitters; ++i)
+    {
+        Entity entity = world.createEntity();
+        world.add<Components::CTransform>(entity, Vec2(x(rng), y(rng)), Vec2(1.0f, 1.0f), 0.0f);
+
+        auto* emitter = world.add<Components::CParticleEmitter>(entity);
+        emitter->setEmissionRate(200.0f);
+        emitter->setMaxParticles(500);
+        emitter->setMinLifetime(1.0f);
+        emitter->setMaxLifetime(2.0f);
+    }
+
+    for (size_t i = 0; i < config.scripts; ++i)
+    {
+        Entity entity = world.createEntity();
+        world.add<Components::CTransform>(entity, Vec2(x(rng), y(rng)), Vec2(1.0f, 1.0f), 0.0f);
+        world.add<Components::CNativeScript>(entity)->bind<StressScript>(unit(rng) * 6.2831853f);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Measurement
+// ─────────────────────────────────────────────────────────────────────────────
+
+size_t peakResidentBytes()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss);  // bytes
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;  // kilobytes
+#endif
+#endif
+}
+
+/**
+ * @brief Nearest-rank percentile of an ascending sample set
+ */
+double percentile(const std::vector<double>& sorted, double fraction)
+{
+    if (sorted.empty())
+    {
+        return 0.0;
+    }
+    const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+    return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+/**
+ * @brief Moves every profiler sample recorded so far into per-scope duration lists (ms)
+ *
+ * Drained regularly so long runs never lose samples to the profiler's fixed-size rings.
+ */
+void drainProfiler(std::map<std::string, std::vector<double>>& scopes)
+{
+    for (const ProfileSample& sample : Profiler::instance().collect())
+    {
+        scopes[sample.name].push_back(static_cast<double>(sample.durationNs) / 1.0e6);
+    }
+    Profiler::instance().clear();
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    ScenarioConfig config;
+    if (!parseArguments(argc, argv, config))
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    Systems::WindowConfig windowConfig;
+    windowConfig.headless = true;
+
+    GameEngine engine(windowConfig, Vec2(0.0f, -10.0f), 4, 1.0f / 60.0f, 100.0f, config.workers);
+    buildScenario(engine.world(), config);
+
+    std::printf("Scenario: %zu barrels, %zu emitters, %zu scripts, seed %u, %zu job workers\n",
+                config.barrels,
+                config.emitters,
+                config.scripts,
+                config.seed,
+                engine.getJobSystem().getWorkerCount());
+
+    engine.step(config.warmupFrames);
+
+    std::vector<double>                        frameMs;
+    std::vector<uint64_t>                      frameAllocations;
+    std::map<std::string, std::vector<double>> scopes;
+    frameMs.reserve(config.frames);
+    frameAllocations.reserve(config.frames);
+
+    Profiler::instance().clear();
+    Profiler::setEnabled(true);
+
+    const uint64_t bytesBefore = g_allocatedBytes.load(std::memory_order_relaxed);
+    for (size_t frame = 0; frame < config.frames && engine.is_running(); ++frame)
+    {
+        const uint64_t allocationsBefore = g_allocationCount.load(std::memory_order_relaxed);
+        const auto     start             = std::chrono::steady_clock::now();
+
+        engine.step(1);
+
+        const auto end = std::chrono::steady_clock::now();
+        frameMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        frameAllocations.push_back(g_allocationCount.load(std::memory_order_relaxed) - allocationsBefore);
+
+        if (frame % 256 == 255)
+        {
+            drainProfiler(scopes);
+        }
+    }
+    const uint64_t bytesAllocated = g_allocatedBytes.load(std::memory_order_relaxed) - bytesBefore;
+
+    Profiler::setEnabled(false);
+    drainProfiler(scopes);
+
+    // ── Frame times ──
+    std::vector<double> sortedFrameMs = frameMs;
+    std::sort(sortedFrameMs.begin(), sortedFrameMs.end());
+
+    double totalMs = 0.0;
+    for (double ms : frameMs)
+    {
+        totalMs += ms;
+    }
+    const double p99Ms = percentile(sortedFrameMs, 0.99);
+
+    std::printf("\nFrame time over %zu frames (ms)\n", frameMs.size());
+    std::printf("  mean %8.3f   p50 %8.3f   p95 %8.3f   p99 %8.3f   max %8.3f\n",
+                totalMs / static_cast<double>(frameMs.size()),
+                percentile(sortedFrameMs, 0.50),
+                percentile(sortedFrameMs, 0.95),
+                p99Ms,
+                sortedFrameMs.back());
+
+    // ── Per-system breakdown, highest total first ──
+    struct ScopeRow
+    {
+        std::string name;
+        double      totalMs;
+        double      meanMs;
+        double      p95Ms;
+        double      maxMs;
+    };
+    std::vector<ScopeRow> rows;
+    for (auto& [name, durations] : scopes)
+    {
+        std::sort(durations.begin(), durations.end());
+        double total = 0.0;
+        for (double ms : durations)
+        {
+            total += ms;
+        }
+        rows.push_back({name,
+                        total,
+                        total / static_cast<double>(frameMs.size()),
+                        percentile(durations, 0.95),
+                        durations.back()});
+    }
+    std::sort(rows.begin(), rows.end(), [](const ScopeRow& a, const ScopeRow& b) { return a.totalMs > b.totalMs; });
+
+    std::printf("\nPer-scope breakdown (ms per frame; scopes may nest and overlap across threads)\n");
+    std::printf("  %-32s %10s %10s %10s %8s\n", "scope", "mean", "p95", "max", "share");
+    for (const ScopeRow& row : rows)
+    {
+        std::printf("  %-32s %10.3f %10.3f %10.3f %7.1f%%\n",
+                    row.name.c_str(),
+                    row.meanMs,
+                    row.p95Ms,
+                    row.maxMs,
+                    totalMs > 0.0 ? 100.0 * row.totalMs / totalMs : 0.0);
+    }
+
+    // ── Memory ──
+    uint64_t totalAllocations = 0;
+    uint64_t maxAllocations   = 0;
+    for (uint64_t count : frameAllocations)
+    {
+        totalAllocations += count;
+        maxAllocations = std::max(maxAllocations, count);
+    }
+    const double allocationsPerFrame = static_cast<double>(totalAllocations) / static_cast<double>(frameMs.size());
+    const double peakMb              = static_cast<double>(peakResidentBytes()) / (1024.0 * 1024.0);
+
+    std::printf("\nMemory\n");
+    std::printf("  peak resident      %10.1f MiB\n", peakMb);
+    std::printf("  allocations/frame  %10.1f mean, %llu max\n",
+                allocationsPerFrame,
+                static_cast<unsigned long long>(maxAllocations));
+    std::printf("  bytes/frame        %10.1f KiB\n",
+                static_cast<double>(bytesAllocated) / static_cast<double>(frameMs.size()) / 1024.0);
+
+    // ── Budgets ──
+    bool withinBudget = true;
+    auto check        = [&withinBudget](const char* what, double value, double budget)
+    {
+        if (budget < 0.0)
+        {
+            return;
+        }
+        const bool ok = value <= budget;
+        std::printf("  %-20s %10.3f / %10.3f  %s\n", what, value, budget, ok ? "ok" : "EXCEEDED");
+        withinBudget = withinBudget && ok;
+    };
+
+    std::printf("\nBudgets\n");
+    check("p99 frame ms", p99Ms, config.budgetP99Ms);
+    check("peak resident MiB", peakMb, config.budgetPeakMb);
+    check("allocations/frame", allocationsPerFrame, config.budgetAllocsPerFrame);
+
+    return withinBudget ? 0 : 1;
+}
@@ -0,0 +1,243 @@
+#ifndef COMPONENT_STORAGE_H
+#define COMPONENT_STORAGE_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Selects how a ComponentStore lays out its dense component array
+ */
+enum class StoragePolicy
+{
+    Packed,  ///< Single contiguous std::vector; swap-and-pop removal (default)
+    Stable   ///< Fixed-size pages that never move; removal leaves a reusable hole
+};
+
+/**
+ * @brief Per-component storage configuration consulted by ComponentStore<T>
+ *
+ * Specialize (or derive from StableComponentStorage) to opt a component type
+ * into pointer-stable storage:
+ *
+ * @code
+ * template <>
+ * struct ComponentStorageTraits<MyComponent> : StableComponentStorage<128>
+ * {
+ * };
+ * @endcode
+ *
+ * With StoragePolicy::Stable, pointers and references returned by add/get/tryGet
+ * stay valid until that component is removed, regardless of other adds/removes.
+ */
+template <typename T>
+struct ComponentStorageTraits
+{
+    static constexpr StoragePolicy policy   = StoragePolicy::Packed;
+    static constexpr size_t        pageSize = 0;
+};
+
+/**
+ * @brief Convenience base for opting a component into paged, pointer-stable storage
+ * @tparam PageSize Number of components per page (iteration is contiguous within a page)
+ */
+template <size_t PageSize = 256>
+struct StableComponentStorage
+{
+    static_assert(PageSize > 0, "StableComponentStorage requires a non-zero page size");
+
+    static constexpr StoragePolicy policy   = StoragePolicy::Stable;
+    static constexpr size_t        pageSize = PageSize;
+};
+
+/**
+ * @brief Slot array backed by fixed-size pages whose elements never relocate
+ *
+ * Slots are addressed by index like a vector, but growth allocates a new page
+ * instead of reallocating, so constructed elements keep their address until
+ * they are erased. Erased slots become vacant and may be re-emplaced later.
+ *
+ * @tparam T Element type
+ * @tparam PageSize Number of elements per page
+ */
+template <typename T, size_t PageSize>
+class PagedArray
+{
+public:
+    static_assert(PageSize > 0, "PagedArray requires a non-zero page size");
+
+    PagedArray() = default;
+    ~PagedArray()
+    {
+        clear();
+    }
+
+    PagedArray(const PagedArray&)            = delete;
+    PagedArray& operator=(const PagedArray&) = delete;
+
+    /**
+     * @brief Number of slots (live or vacant) below the high-water mark
+     */
+    size_t size() const
+    {
+        return m_live.size();
+    }
+
+    /**
+     * @brief Whether the slot currently holds a constructed element
+     */
+    bool isLive(size_t slot) const
+    {
+        return slot < m_live.size() && m_live[slot] != 0;
+    }
+
+    /**
+     * @brief Constructs an element in a vacant slot, or in a new slot when slot == size()
+     */
+    template <typename... Args>
+    T& emplace(size_t slot, Args&&... args)
+    {
+        assert(slot <= m_live.size() && "PagedArray::emplace slot out of range");
+        assert(!isLive(slot) && "PagedArray::emplace slot already occupied");
+
+        if (slot == m_live.size())
+        {
+            if (slot / PageSize >= m_pages.size())
+            {
+                m_pages.push_back(std::make_unique<Page>());
+            }
+            m_live.push_back(0);
+        }
+
+        T* element   = new (address(slot)) T(std::forward<Args>(args)...);
+        m_live[slot] = 1;
+        return *element;
+    }
+
+    /**
+     * @brief Destroys the element in a slot, leaving it vacant
+     */
+    void erase(size_t slot)
+    {
+        assert(isLive(slot) && "PagedArray::erase slot is not occupied");
+        std::launder(reinterpret_cast<T*>(address(slot)))->~T();
+        m_live[slot] = 0;
+    }
+
+    T& operator[](size_t slot)
+    {
+        assert(isLive(slot) && "PagedArray access to vacant slot");
+        return *std::launder(reinterpret_cast<T*>(address(slot)));
+    }
+
+    const T& operator[](size_t slot) const
+    {
+        assert(isLive(slot) && "PagedArray access to vacant slot");
+        return *std::launder(reinterpret_cast<const T*>(address(slot)));
+    }
+
+    /**
+     * @brief Destroys all live elements and releases every page
+     */
+    void clear()
+    {
+        for (size_t slot = 0; slot < m_live.size(); ++slot)
+        {
+            if (m_live[slot] != 0)
+            {
+                erase(slot);
+            }
+        }
+        m_live.clear();
+        m_pages.clear();
+    }
+
+private:
+    struct Page
+    {
+        alignas(T) unsigned char bytes[sizeof(T) * PageSize];
+    };
+
+    unsigned char* address(size_t slot)
+    {
+        return m_pages[slot / PageSize]->bytes + (slot % PageSize) * sizeof(T);
+    }
+
+    const unsigned char* address(size_t slot) const
+    {
+        return m_pages[slot / PageSize]->bytes + (slot % PageSize) * sizeof(T);
+    }
+
+    std::vector<std::unique_ptr<Page>> m_pages;  ///< Pages are never reallocated once created
+    std::vector<uint8_t>               m_live;   ///< Per-slot occupancy flag
+};
+
+/**
+ * @brief Owning handle that keeps a component's cold data out of its dense store
+ *
+ * Heavy, rarely-touched configuration is allocated once on the heap and the
+ * component only carries this pointer-sized handle. Swap-and-pop removal and
+ * views over the component then move/stream just the hot runtime fields, while
+ * the cold data keeps a stable address for the component's lifetime.
+ *
+ * Copying deep-copies the cold data; moving transfers ownership.
+ *
+ * @tparam T Cold data type (must be default constructible)
+ */
+template <typename T>
+class ColdData
+{
+public:
+    ColdData() : m_data(std::make_unique<T>()) {}
+    explicit ColdData(const T& data) : m_data(std::make_unique<T>(data)) {}
+
+    ColdData(const ColdData& other) : m_data(std::make_unique<T>(*other)) {}
+    ColdData& operator=(const ColdData& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        if (m_data)
+        {
+            *m_data = *other;
+        }
+        else
+        {
+            m_data = std::make_unique<T>(*other);
+        }
+        return *this;
+    }
+
+    ColdData(ColdData&&) noexcept            = default;
+    ColdData& operator=(ColdData&&) noexcept = default;
+    ~ColdData()                              = default;
+
+    T& operator*()
+    {
+        assert(m_data && "ColdData accessed after move");
+        return *m_data;
+    }
+    const T& operator*() const
+    {
+        assert(m_data && "ColdData accessed after move");
+        return *m_data;
+    }
+    T* operator->()
+    {
+        return &**this;
+    }
+    const T* operator->() const
+    {
+        return &**this;
+    }
+
+private:
+    std::unique_ptr<T> m_data;
+};
+
+#endif  // COMPONENT_STORAGE_H
@@ -1,22 +1,30 @@
 #ifndef GAMEENGINE_H
 #define GAMEENGINE_H
 
+#include <array>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 // Include ECS core
+#include <EngineStats.h>
 #include <Entity.h>
+#include <FrameAllocator.h>
+#include <FramePacer.h>
 #include <Vec2.h>
 #include <World.h>
 
 // Include system and manager headers
+#include <JobSystem.h>
 #include <S2DPhysics.h>
 #include <SAudio.h>
 #include <SInput.h>
 #include <SParticle.h>
 #include <SRenderer.h>
 #include <SScript.h>
+#include <SystemScheduler.h>
 
 // Convenient namespace declarations for documentation
 // Entity is now a plain struct (just an ID), not in a namespace
@@ -59,14 +67,16 @@ public:
      * @param windowConfig Window initialization configuration
      * @param gravity The global gravity vector (Y-up: positive Y = upward, default: {0.0f, -10.0f})
      * @param subStepCount Number of physics sub-steps per update (default: 6, increase for more stability with many bodies)
-     * @param timeStep Fixed time step for physics updates
+     * @param timeStep Fixed time step for physics (and the default for other fixed-step systems)
      * @param pixelsPerMeter Rendering scale for particle system (default: 100.0f)
+     * @param jobWorkerCount Worker threads for the shared job system (default: 0 = hardware threads - 1)
      */
     GameEngine(const Systems::WindowConfig& windowConfig,
                Vec2                         gravity        = Vec2(0.0f, -10.0f),
                uint8_t                      subStepCount   = 6,
                float                        timeStep       = 1.0f / 60.0f,
-               float                        pixelsPerMeter = 100.0f);
+               float                        pixelsPerMeter = 100.0f,
+               size_t                       jobWorkerCount = 0);
 
     /** @brief Destructor */
     ~GameEngine();
@@ -85,17 +95,105 @@ public:
      */
     void update(float deltaTime);
 
+    /**
+     * @brief Advances the simulation by whole engine time steps as fast as possible
+     * @param steps Number of update(getTimeStep()) calls to make
+     *
+     * Each step ticks physics exactly once and nothing is rendered or paced, which
+     * suits headless batch simulation, soak tests and benchmarks. Stops early if
+     * the engine stops running.
+     */
+    void step(size_t steps = 1);
+
+    /**
+     * @brief Re-runs a recorded input session through the simulation, one update() per recorded frame
+     * @param recording Session captured with SInput::startRecording()
+     * @param useRecordedDeltaTimes Update with each frame's recorded delta time instead of getTimeStep()
+     * @return Number of frames replayed
+     *
+     * Like step(), nothing is rendered or paced, so a session replays as fast as the
+     * CPU allows, e.g. headless under the profiler. The default fixed time step makes
+     * repeated replays of the same recording produce identical results; recorded delta
+     * times reproduce the original session's timing instead. Stops early if the engine
+     * stops running (a replayed window close does that too).
+     */
+    size_t replayInput(const Systems::InputRecording& recording, bool useRecordedDeltaTimes = false);
+
     /**
      * @brief Renders the current game state
+     *
+     * With pipelined rendering enabled this only records the frame and hands it
+     * to a job; the window is cleared, drawn and displayed on a worker thread.
      */
     void render();
 
+    /**
+     * @brief Overlaps drawing frame N with simulating frame N+1
+     * @param enabled true to submit frames from a job, false to draw synchronously
+     *
+     * render() records the world into one of two RenderFrames and returns once a
+     * job is submitting it; the next render() waits for that job before handing
+     * over the other buffer. Presentation therefore lags the simulation by at most
+     * one frame and a frame costs roughly max(update, draw) instead of their sum.
+     *
+     * While enabled, the window must not be drawn to, closed, or have its renderer
+     * caches cleared outside render() without calling waitForRenderedFrame() first.
+     * Recording never creates textures or shaders: those first used by a frame are
+     * created only after the previous job has finished, so they show up one frame
+     * after they would synchronously. Without job workers render() stays synchronous.
+     */
+    void setPipelinedRendering(bool enabled);
+
+    /**
+     * @brief Whether render() hands frames to a job (see setPipelinedRendering)
+     */
+    bool isPipelinedRendering() const
+    {
+        return m_pipelinedRendering;
+    }
+
+    /**
+     * @brief Blocks until the frame handed to the render job, if any, has been displayed
+     */
+    void waitForRenderedFrame();
+
+    /**
+     * @brief Fraction of a physics step elapsed since the last step, in [0, 1]
+     *
+     * render() blends each interpolated CTransform between its previous and
+     * current fixed-step poses by this amount, so physics can tick slower than
+     * the display refresh rate without visible stepping.
+     */
+    float getInterpolationAlpha() const
+    {
+        return m_interpolationAlpha;
+    }
+
     /**
      * @brief Checks if the game is still running
      * @return true if the game is running, false otherwise
      */
     bool is_running() const;
 
+    /**
+     * @brief Whether the engine was created with WindowConfig::headless
+     *
+     * Headless engines never open a window, render() does nothing, and audio
+     * uses AudioBackend::Null. Every simulation system still updates.
+     */
+    bool isHeadless() const
+    {
+        return m_headless;
+    }
+
+    /**
+     * @brief Default fixed time step (physics step) in seconds
+     */
+    float getTimeStep() const
+    {
+        return m_timeStep;
+    }
+
     // System and Manager Accessors
 
     /**
@@ -128,6 +226,84 @@ public:
      */
     Systems::SParticle& getParticleSystem();
 
+    /**
+     * @brief Gets the shared job system used for multithreaded work
+     * @return Reference to the engine-owned JobSystem
+     */
+    Systems::JobSystem& getJobSystem();
+
+    /**
+     * @brief Gets the limiter that paces the main loop to WindowConfig::frameLimit
+     *
+     * Call waitForNextFrame() once per loop iteration and pass its result to update().
+     * A loop that never does so is still capped: render() then waits on the pacer
+     * itself, once per frame, and logs a warning the first time.
+     */
+    FramePacer& getFramePacer()
+    {
+        return m_framePacer;
+    }
+
+    /**
+     * @brief Gets the allocator behind World::frameMemory(), reset at the start of every update
+     */
+    FrameAllocator& getFrameAllocator()
+    {
+        return m_frameAllocator;
+    }
+
+    /**
+     * @brief Runtime counters captured at the end of the last update()
+     *
+     * Entity and component counts, render queue and draw calls, particles, Box2D
+     * bodies/shapes and step time, active sound slots, the command-buffer size at
+     * flush, and every counter registered through getStatCounters().
+     */
+    const EngineStats& stats() const
+    {
+        return m_stats;
+    }
+
+    /**
+     * @brief Gets the registry custom systems publish their own counters through
+     */
+    StatCounters& getStatCounters()
+    {
+        return m_statCounters;
+    }
+
+    /**
+     * @brief Creates a user system owned by the engine and schedules it every update
+     * @tparam T System type (derives from Systems::ISystem)
+     * @return Reference to the new system
+     *
+     * The system runs in its stage() after every previously registered system it
+     * conflicts with (see ISystem::declareAccess); otherwise it may run concurrently.
+     */
+    template <typename T, typename... Args>
+    T& addSystem(Args&&... args)
+    {
+        auto system = std::make_unique<T>(std::forward<Args>(args)...);
+        T&   ref    = *system;
+        m_scheduler.addSystem(system.get());
+        m_userSystems.push_back(std::move(system));
+        return ref;
+    }
+
+    /**
+     * @brief Unschedules a system and destroys it if it was created through addSystem()
+     * @return true if the system was scheduled
+     */
+    bool removeSystem(Systems::ISystem& system);
+
+    /**
+     * @brief Gets the scheduler that orders and dispatches system updates
+     */
+    Systems::SystemScheduler& getScheduler()
+    {
+        return m_scheduler;
+    }
+
     /**
      * @brief Creates a new entity in the world
      * @return The created entity ID
@@ -150,6 +326,12 @@ public:
     }
 
 private:
+    // Declared first so it is destroyed last: systems may still hold jobs during their own teardown
+    std::unique_ptr<Systems::JobSystem> m_jobs;  ///< Shared worker pool owned by engine
+
+    // Declared before m_world, which hands it out as frameMemory()
+    FrameAllocator m_frameAllocator;  ///< Transient per-frame memory for systems
+
     std::unique_ptr<Systems::SRenderer>  m_renderer;  ///< Renderer owned by engine
     std::unique_ptr<Systems::SInput>     m_input;     ///< Input system owned by engine
     std::unique_ptr<Systems::SScript>    m_script;    ///< Script system owned by engine
@@ -157,15 +339,42 @@ private:
     std::unique_ptr<Systems::SParticle>  m_particle;  ///< Particle system owned by engine
     std::unique_ptr<Systems::SAudio>     m_audio;     ///< Audio system owned by engine
 
-    std::vector<Systems::ISystem*> m_systemOrder;   ///< Ordered system update list
-    World                          m_world;         ///< Central world (registry + lifecycle)
-    const uint8_t                  m_subStepCount;  ///< Number of physics sub-steps per update
-    const float                    m_timeStep;      ///< Fixed time step for physics updates
+    std::vector<std::unique_ptr<Systems::ISystem>> m_userSystems;   ///< Systems added through addSystem()
+    Systems::SystemScheduler                       m_scheduler;     ///< Per-stage dependency graph of all systems
+    World                                          m_world;         ///< Central world (registry + lifecycle)
+    const uint8_t                                  m_subStepCount;  ///< Number of physics sub-steps per update
+    const float                                    m_timeStep;      ///< Default fixed time step (physics step)
+    const bool                                     m_headless;      ///< No window, rendering or audio device
+
+    bool  m_gameRunning        = false;  ///< Flag indicating if the game is running
+    float m_interpolationAlpha = 1.0f;   ///< Physics accumulator / step after the last update
+
+    std::unordered_map<const Systems::ISystem*, float> m_accumulators;    ///< Per-system fixed-step / tick-interval time
+    std::unordered_map<const Systems::ISystem*, float> m_tickCountdowns;  ///< Time left until a throttled system's next tick
+
+    std::array<Systems::RenderFrame, 2> m_renderFrames;                ///< Recorded by render(), drawn by the render job
+    size_t                              m_renderFrameIndex   = 0;      ///< Buffer the next render() records into
+    Systems::JobCounter                 m_renderJob;                   ///< Tracks the frame being submitted
+    bool                                m_pipelinedRendering = false;  ///< Submit frames from a job
+
+    Vec2       m_gravity;     ///< Global gravity vector
+    FramePacer m_framePacer;  ///< Main-loop limiter and delta-time source
+
+    uint64_t m_pacedFrames       = 0;      ///< Pacer frame count when render() last checked it
+    bool     m_warnedUnpacedLoop = false;  ///< Warned that render() paces a loop that never waits itself
 
-    bool  m_gameRunning = false;  ///< Flag indicating if the game is running
-    float m_accumulator = 0.0f;   ///< Accumulator for fixed timestep updates
+    StatCounters m_statCounters;  ///< Counters registered by custom systems
+    EngineStats  m_stats;         ///< Snapshot refreshed by every update()
 
-    Vec2 m_gravity;  ///< Global gravity vector
+    /**
+     * @brief Resolves a system's fixed step, falling back to the engine default
+     */
+    float fixedStepFor(const Systems::ISystem& system) const;
+
+    /**
+     * @brief Refreshes m_stats from the world and the built-in systems
+     */
+    void updateStats();
 
     /**
      * @brief Registers all component types with stable names for serialization
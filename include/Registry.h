@@ -9,6 +9,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -18,9 +19,9 @@
 #include <utility>
 #include <vector>
 
-#include <cstdio>
-
+#include <ComponentStorage.h>
 #include <EntityManager.h>
+#include <Log.h>
 
 /**
  * @brief Type-erased interface for component storage
@@ -55,10 +56,12 @@ public:
 };
 
 /**
- * @brief Dense component storage with sparse entity->index mapping (vector-based)
+ * @brief Dense component storage with sparse entity->index mapping
  *
  * Components are stored densely; a sparse vector maps entity index -> dense index.
- * Removal uses swap-and-pop while keeping the sparse mapping up to date.
+ * The dense layout follows ComponentStorageTraits<T>::policy:
+ * - Packed: a single std::vector; removal uses swap-and-pop while keeping the sparse mapping up to date.
+ * - Stable: a PagedArray whose elements never move; removal leaves a hole (null entity) that later adds reuse.
  *
  * @tparam T Component type
  */
@@ -66,6 +69,12 @@ template <typename T>
 class ComponentStore : public IComponentStore
 {
 public:
+    using Traits = ComponentStorageTraits<T>;
+
+    static constexpr bool kStable = Traits::policy == StoragePolicy::Stable;
+
+    using DenseStorage = std::conditional_t<kStable, PagedArray<T, Traits::pageSize>, std::vector<T>>;
+
     ComponentStore() = default;
 
     /**
@@ -84,15 +93,36 @@ public:
             return m_dense[denseIndex];
         }
 
-        auto denseIndex        = static_cast<uint32_t>(m_dense.size());
-        m_sparse[entity.index] = denseIndex;
-        m_entities.push_back(entity);
-        m_dense.emplace_back(std::forward<Args>(args)...);
-        return m_dense.back();
+        if constexpr (kStable)
+        {
+            uint32_t denseIndex = static_cast<uint32_t>(m_entities.size());
+            if (!m_freeSlots.empty())
+            {
+                denseIndex = m_freeSlots.back();
+                m_freeSlots.pop_back();
+                m_entities[denseIndex] = entity;
+            }
+            else
+            {
+                m_entities.push_back(entity);
+            }
+
+            m_sparse[entity.index] = denseIndex;
+            ++m_liveCount;
+            return m_dense.emplace(denseIndex, std::forward<Args>(args)...);
+        }
+        else
+        {
+            auto denseIndex        = static_cast<uint32_t>(m_dense.size());
+            m_sparse[entity.index] = denseIndex;
+            m_entities.push_back(entity);
+            m_dense.emplace_back(std::forward<Args>(args)...);
+            return m_dense.back();
+        }
     }
 
     /**
-     * @brief Removes component for an entity using swap-and-pop
+     * @brief Removes component for an entity (swap-and-pop, or in-place for stable storage)
      */
     void remove(Entity entity) override
     {
@@ -102,18 +132,30 @@ public:
         }
 
         auto denseIndex = m_sparse[entity.index];
-        auto lastIndex  = static_cast<uint32_t>(m_dense.size() - 1);
 
-        if (denseIndex != lastIndex)
+        if constexpr (kStable)
         {
-            std::swap(m_dense[denseIndex], m_dense[lastIndex]);
-            std::swap(m_entities[denseIndex], m_entities[lastIndex]);
-            m_sparse[m_entities[denseIndex].index] = denseIndex;
+            m_dense.erase(denseIndex);
+            m_entities[denseIndex] = Entity::null();
+            m_freeSlots.push_back(denseIndex);
+            --m_liveCount;
+        }
+        else
+        {
+            auto lastIndex = static_cast<uint32_t>(m_dense.size() - 1);
+
+            if (denseIndex != lastIndex)
+            {
+                std::swap(m_dense[denseIndex], m_dense[lastIndex]);
+                std::swap(m_entities[denseIndex], m_entities[lastIndex]);
+                m_sparse[m_entities[denseIndex].index] = denseIndex;
+            }
+
+            m_dense.pop_back();
+            m_entities.pop_back();
         }
 
         m_sparse[entity.index] = kInvalid;
-        m_dense.pop_back();
-        m_entities.pop_back();
     }
 
     /**
@@ -164,8 +206,12 @@ public:
     template <typename Func>
     void each(Func&& fn)
     {
-        for (size_t i = 0; i < m_dense.size(); ++i)
+        for (size_t i = 0; i < m_entities.size(); ++i)
         {
+            if (kStable && !m_entities[i].isValid())
+            {
+                continue;
+            }
             fn(m_entities[i], m_dense[i]);
         }
     }
@@ -176,8 +222,12 @@ public:
     template <typename Func>
     void each(Func&& fn) const
     {
-        for (size_t i = 0; i < m_dense.size(); ++i)
+        for (size_t i = 0; i < m_entities.size(); ++i)
         {
+            if (kStable && !m_entities[i].isValid())
+            {
+                continue;
+            }
             fn(m_entities[i], m_dense[i]);
         }
     }
@@ -187,7 +237,14 @@ public:
      */
     size_t size() const override
     {
-        return m_dense.size();
+        if constexpr (kStable)
+        {
+            return m_liveCount;
+        }
+        else
+        {
+            return m_dense.size();
+        }
     }
 
     /**
@@ -198,11 +255,14 @@ public:
         return typeid(T).name();
     }
 
-    std::vector<T>& components()
+    /**
+     * @brief Dense component slots, parallel to entities(); stable stores may contain holes (null entity)
+     */
+    DenseStorage& components()
     {
         return m_dense;
     }
-    const std::vector<T>& components() const
+    const DenseStorage& components() const
     {
         return m_dense;
     }
@@ -227,9 +287,11 @@ private:
 
     static constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
 
-    std::vector<uint32_t> m_sparse;    ///< Entity index -> dense index mapping
-    std::vector<Entity>   m_entities;  ///< Parallel array of entity handles
-    std::vector<T>        m_dense;     ///< Densely-packed component array
+    std::vector<uint32_t> m_sparse;         ///< Entity index -> dense index mapping
+    std::vector<Entity>   m_entities;       ///< Parallel array of entity handles (null marks a stable-storage hole)
+    DenseStorage          m_dense;          ///< Densely-packed component array
+    std::vector<uint32_t> m_freeSlots;      ///< Reusable holes (stable storage only)
+    size_t                m_liveCount = 0;  ///< Live components (stable storage only)
 };
 
 /**
@@ -369,6 +431,14 @@ public:
         return m_deferredDestroy.size();
     }
 
+    /**
+     * @brief Gets the number of deferred structural commands waiting for flushCommandBuffer()
+     */
+    size_t pendingCommandCount() const
+    {
+        return m_commandBuffer.size();
+    }
+
     /**
      * @brief Checks if an entity handle is alive
      */
@@ -655,6 +725,10 @@ public:
             for (size_t i = 0; i < components.size(); ++i)
             {
                 Entity entity = entities[i];
+                if (!entity.isValid())
+                {
+                    continue;  // Hole left by a removal in stable storage
+                }
                 if (!ensureAlive(entity, "view"))
                 {
                     continue;
@@ -708,6 +782,10 @@ public:
             for (size_t i = 0; i < components.size(); ++i)
             {
                 Entity entity = entities[i];
+                if (!entity.isValid())
+                {
+                    continue;  // Hole left by a removal in stable storage
+                }
                 if (!ensureAlive(entity, "view"))
                 {
                     continue;
@@ -735,23 +813,36 @@ public:
     {
         static_assert(sizeof...(Components) > 0, "Registry::viewSorted requires at least one component");
 
-        using Item = std::tuple<Entity, Components*...>;
-        std::vector<Item> items;
+        // The trailing visit index makes std::sort stable without stable_sort's temporary buffer
+        using Item = std::tuple<Entity, size_t, Components*...>;
+        std::pmr::vector<Item> items(frameMemory());
 
-        view<Components...>([&](Entity entity, Components&... comps) { items.emplace_back(entity, &comps...); });
+        view<Components...>([&](Entity entity, Components&... comps)
+                            { items.emplace_back(entity, items.size(), &comps...); });
 
         if (items.empty())
         {
             return;
         }
 
-        std::stable_sort(items.begin(),
-                         items.end(),
-                         [&](const Item& lhs, const Item& rhs) { return compare(std::get<0>(lhs), std::get<0>(rhs)); });
+        std::sort(items.begin(),
+                  items.end(),
+                  [&](const Item& lhs, const Item& rhs)
+                  {
+                      if (compare(std::get<0>(lhs), std::get<0>(rhs)))
+                      {
+                          return true;
+                      }
+                      if (compare(std::get<0>(rhs), std::get<0>(lhs)))
+                      {
+                          return false;
+                      }
+                      return std::get<1>(lhs) < std::get<1>(rhs);
+                  });
 
         for (const auto& item : items)
         {
-            std::apply([&](Entity entity, Components*... comps) { fn(entity, *comps...); }, item);
+            std::apply([&](Entity entity, size_t, Components*... comps) { fn(entity, *comps...); }, item);
         }
     }
 
@@ -766,26 +857,56 @@ public:
     {
         static_assert(sizeof...(Components) > 0, "Registry::viewSorted requires at least one component");
 
-        using Item = std::tuple<Entity, const Components*...>;
-        std::vector<Item> items;
+        // The trailing visit index makes std::sort stable without stable_sort's temporary buffer
+        using Item = std::tuple<Entity, size_t, const Components*...>;
+        std::pmr::vector<Item> items(frameMemory());
 
-        view<Components...>([&](Entity entity, const Components&... comps) { items.emplace_back(entity, &comps...); });
+        view<Components...>([&](Entity entity, const Components&... comps)
+                            { items.emplace_back(entity, items.size(), &comps...); });
 
         if (items.empty())
         {
             return;
         }
 
-        std::stable_sort(items.begin(),
-                         items.end(),
-                         [&](const Item& lhs, const Item& rhs) { return compare(std::get<0>(lhs), std::get<0>(rhs)); });
+        std::sort(items.begin(),
+                  items.end(),
+                  [&](const Item& lhs, const Item& rhs)
+                  {
+                      if (compare(std::get<0>(lhs), std::get<0>(rhs)))
+                      {
+                          return true;
+                      }
+                      if (compare(std::get<0>(rhs), std::get<0>(lhs)))
+                      {
+                          return false;
+                      }
+                      return std::get<1>(lhs) < std::get<1>(rhs);
+                  });
 
         for (const auto& item : items)
         {
-            std::apply([&](Entity entity, const Components*... comps) { fn(entity, *comps...); }, item);
+            std::apply([&](Entity entity, size_t, const Components*... comps) { fn(entity, *comps...); }, item);
         }
     }
 
+    /**
+     * @brief Sets the scratch memory used for per-call temporaries (e.g. viewSorted)
+     * @param memory Resource released every frame, or nullptr for the default resource
+     */
+    void setFrameMemory(std::pmr::memory_resource* memory)
+    {
+        m_frameMemory = memory;
+    }
+
+    /**
+     * @brief Scratch memory for per-call temporaries
+     */
+    std::pmr::memory_resource* frameMemory() const
+    {
+        return m_frameMemory ? m_frameMemory : std::pmr::get_default_resource();
+    }
+
     template <typename A, typename B, typename Func>
     void view2(Func&& fn)
     {
@@ -818,6 +939,21 @@ public:
         return m_entities;
     }
 
+    /**
+     * @brief Calls fn(typeName, count) with the live component count of every component type in use
+     *
+     * Unregistered types are reported by their mangled typeid name. Does not allocate.
+     */
+    template <typename Func>
+    void eachComponentCount(Func&& fn) const
+    {
+        for (const auto& [typeIdx, store] : m_componentStores)
+        {
+            auto name = m_typeNames.find(typeIdx);
+            fn(name != m_typeNames.end() ? name->second.c_str() : typeIdx.name(), store->size());
+        }
+    }
+
     /**
      * @brief Gets the tracked component types for an entity
      */
@@ -998,29 +1134,32 @@ private:
 
     void logDead(const char* action, Entity entity) const
     {
-        std::fprintf(stderr,
-                     "GameEngine: %s: dead entity idx=%u gen=%u ignored\n",
-                     action,
-                     static_cast<unsigned>(entity.index),
-                     static_cast<unsigned>(entity.generation));
+        // Stale handles tend to be hit every frame by the same caller, so keep this from flooding the log
+        GAMEENGINE_LOG_RATE_LIMITED(LogLevel::Warn,
+                                    "GameEngine: %s: dead entity idx=%u gen=%u ignored",
+                                    action,
+                                    static_cast<unsigned>(entity.index),
+                                    static_cast<unsigned>(entity.generation));
     }
 
     void logTypeNameMismatch(const std::string& existing, const std::string& incoming) const
     {
-        std::fprintf(stderr,
-                     "GameEngine: Component type registered with two names: existing='%s' new='%s'\n",
-                     existing.c_str(),
-                     incoming.c_str());
+        Log::write(LogLevel::Warn,
+                   "GameEngine: Component type registered with two names: existing='%s' new='%s'",
+                   existing.c_str(),
+                   incoming.c_str());
     }
 
     void logTypeNameCollision(const std::string& typeName) const
     {
-        std::fprintf(stderr, "GameEngine: Component type name '%s' already mapped to a different type\n", typeName.c_str());
+        Log::write(LogLevel::Error,
+                   "GameEngine: Component type name '%s' already mapped to a different type",
+                   typeName.c_str());
     }
 
     void logTypeLookupFailure(const std::string& typeName) const
     {
-        std::fprintf(stderr, "GameEngine: Component type name '%s' not registered\n", typeName.c_str());
+        Log::write(LogLevel::Warn, "GameEngine: Component type name '%s' not registered", typeName.c_str());
     }
 
     void trackComponentAdd(Entity entity, std::type_index typeIdx)
@@ -1078,6 +1217,9 @@ private:
 
     /// Per-entity component composition (type_index list)
     std::vector<std::vector<std::type_index>> m_entityComposition;
+
+    /// Scratch memory for temporaries (nullptr = default resource)
+    std::pmr::memory_resource* m_frameMemory = nullptr;
 };
 
 #endif  // REGISTRY_H
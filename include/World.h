@@ -264,11 +264,28 @@ public:
     {
         return m_registry.pendingDestroyCount();
     }
+    size_t pendingCommandCount() const
+    {
+        return m_registry.pendingCommandCount();
+    }
     bool isAlive(Entity e) const
     {
         return m_registry.isAlive(e);
     }
 
+    /**
+     * @brief Sets the scratch memory used for per-call temporaries such as viewSorted()'s item list
+     * @param memory Resource released every frame (GameEngine passes its FrameAllocator), or nullptr
+     */
+    void setFrameMemory(std::pmr::memory_resource* memory)
+    {
+        m_registry.setFrameMemory(memory);
+    }
+    std::pmr::memory_resource* frameMemory() const
+    {
+        return m_registry.frameMemory();
+    }
+
     Components components()
     {
         return Components(*this);
@@ -445,6 +462,11 @@ public:
     {
         return m_registry.getComposition(e);
     }
+    template <typename Func>
+    void eachComponentCount(Func&& fn) const
+    {
+        m_registry.eachComponentCount(std::forward<Func>(fn));
+    }
 
     void clear()
     {
@@ -1,7 +1,9 @@
 #ifndef CNATIVESCRIPT_H
 #define CNATIVESCRIPT_H
 
+#include <ComponentStorage.h>
 #include <Entity.h>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -25,18 +27,29 @@ public:
     virtual void onUpdate(float deltaTime, Entity self, World& world) = 0;
 };
 
+/**
+ * @brief Native script attached to an entity
+ *
+ * Scripts that do not need per-frame updates can set updateInterval to N: onUpdate then
+ * runs every N frames with the time accumulated since its previous call. SScript spreads
+ * scripts sharing an interval round-robin over those N frames to keep per-frame cost flat.
+ */
 struct CNativeScript
 {
     std::unique_ptr<INativeScript> instance;
-    bool                           created = false;
+    bool                           created        = false;
+    uint32_t                       updateInterval = 1;     ///< Frames between onUpdate calls (0 or 1 = every frame)
+    uint32_t                       bucket         = 0;     ///< Frame slot within updateInterval, assigned by SScript
+    float                          pendingTime    = 0.0f;  ///< Seconds accumulated since the last onUpdate
 
     template <typename T, typename... Args>
     void bind(Args&&... args)
     {
         static_assert(std::is_base_of<INativeScript, T>::value,
                       "CNativeScript::bind requires T to derive from INativeScript");
-        instance = std::make_unique<T>(std::forward<Args>(args)...);
-        created  = false;
+        instance    = std::make_unique<T>(std::forward<Args>(args)...);
+        created     = false;
+        pendingTime = 0.0f;
     }
 
     bool isBound() const
@@ -47,4 +60,13 @@ struct CNativeScript
 
 }  // namespace Components
 
+/**
+ * @brief Scripts live in pointer-stable storage so SScript can keep a CNativeScript* across
+ *        onCreate/onUpdate even when those callbacks add more scripts.
+ */
+template <>
+struct ComponentStorageTraits<Components::CNativeScript> : StableComponentStorage<64>
+{
+};
+
 #endif  // CNATIVESCRIPT_H
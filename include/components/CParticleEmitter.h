@@ -5,7 +5,9 @@
 #include <cstddef>
 #include <string>
 #include <vector>
+#include "AssetHandle.h"
 #include "Color.h"
+#include "ComponentStorage.h"
 #include "Vec2.h"
 
 namespace Components
@@ -49,11 +51,62 @@ struct Particle
     bool  alive{false};              ///< Is particle still alive?
 };
 
+/**
+ * @brief Authoring configuration for a particle emitter
+ *
+ * Kept separate from the emitter's runtime state so it can live out of line
+ * (see CParticleEmitter::m_config). Edit it through CParticleEmitter's setters
+ * or getConfig().
+ */
+struct ParticleEmitterConfig
+{
+    // Emission
+    Vec2  direction        = Vec2(0, 1);        ///< Base emission direction (normalized)
+    float spreadAngle      = 0.5f;              ///< Spread angle in radians (cone of emission)
+    float minSpeed         = 0.1f;              ///< Minimum initial speed (m/s)
+    float maxSpeed         = 0.3f;              ///< Maximum initial speed (m/s)
+    float minLifetime      = 1.0f;              ///< Minimum particle lifetime (seconds)
+    float maxLifetime      = 1.5f;              ///< Maximum particle lifetime (seconds)
+    float minSize          = 0.50f;             ///< Minimum particle size (meters)
+    float maxSize          = 0.50f;             ///< Maximum particle size (meters)
+    float emissionRate     = 10.0f;             ///< Particles per second
+    float burstCount       = 0.0f;              ///< Number of particles to emit in a burst
+    Color startColor       = Color::White;      ///< Starting color
+    Color endColor         = Color::Cyan;       ///< Ending color (for color interpolation)
+    float startAlpha       = 1.0f;              ///< Starting alpha
+    float endAlpha         = 1.0f;              ///< Ending alpha
+    Vec2  gravity          = Vec2(0, 0.2f);     ///< Gravity/constant acceleration (m/s²)
+    float minRotationSpeed = -1.0f;             ///< Minimum rotation speed (radians/second)
+    float maxRotationSpeed = 1.0f;              ///< Maximum rotation speed (radians/second)
+    bool  fadeOut          = true;              ///< Should particles fade out over lifetime?
+    bool  shrink           = true;              ///< Should particles shrink over lifetime?
+    float shrinkEndScale   = 0.1f;              ///< Final size scale when fully shrunk
+    int   maxParticles     = 200;               ///< Maximum number of particles
+    Vec2  positionOffset   = Vec2(0.0f, 0.0f);  ///< Offset from entity position
+
+    // Emission shape configuration
+    EmissionShape     emissionShape = EmissionShape::Point;  ///< Shape for emission distribution
+    float             shapeRadius   = 1.0f;                  ///< Radius for circle shape (meters)
+    Vec2              shapeSize     = Vec2(1.0f, 1.0f);      ///< Size for rectangle shape (meters)
+    Vec2              lineStart     = Vec2(-0.5f, 0.0f);     ///< Start point for line shape
+    Vec2              lineEnd       = Vec2(0.5f, 0.0f);      ///< End point for line shape
+    std::vector<Vec2> polygonVertices;                       ///< Vertices for polygon shape
+    bool              emitFromEdge = true;                   ///< Emit from edge (true) or filled area (false)
+    bool              emitOutward  = false;                  ///< Emit in direction away from shape center
+
+    // Resources (by reference)
+    std::string texturePath;  ///< Optional texture path for particles
+};
+
 /**
  * @brief Component that defines a particle emitter attached to an entity
  *
  * This component contains all particle emission configuration and state.
  * The emitter automatically follows the entity's transform position.
+ *
+ * Only the hot runtime state (enabled flag, z-index, emission timer and the
+ * particle pool) is stored inline; the ~30 configuration fields live behind a
+ * ColdData handle so views and swap-and-pop removal stay cheap.
  */
 struct CParticleEmitter
 {
@@ -61,6 +114,11 @@ public:
     CParticleEmitter()  = default;
     ~CParticleEmitter() = default;
 
+    CParticleEmitter(const CParticleEmitter&)                = default;
+    CParticleEmitter& operator=(const CParticleEmitter&)     = default;
+    CParticleEmitter(CParticleEmitter&&) noexcept            = default;
+    CParticleEmitter& operator=(CParticleEmitter&&) noexcept = default;
+
     /**
      * @brief Get number of alive particles
      * @return Count of currently alive particles
@@ -80,268 +138,288 @@ public:
         m_enabled = active;
     }
 
+    /**
+     * @brief Direct access to the cold configuration block
+     */
+    inline ParticleEmitterConfig& getConfig()
+    {
+        return *m_config;
+    }
+    inline const ParticleEmitterConfig& getConfig() const
+    {
+        return *m_config;
+    }
+
     // Configuration getters/setters
     inline Vec2 getDirection() const
     {
-        return m_direction;
+        return m_config->direction;
     }
     inline void setDirection(const Vec2& dir)
     {
-        m_direction = dir;
+        m_config->direction = dir;
     }
     inline float getSpreadAngle() const
     {
-        return m_spreadAngle;
+        return m_config->spreadAngle;
     }
     inline void setSpreadAngle(float angle)
     {
-        m_spreadAngle = angle;
+        m_config->spreadAngle = angle;
     }
     inline float getMinSpeed() const
     {
-        return m_minSpeed;
+        return m_config->minSpeed;
     }
     inline void setMinSpeed(float speed)
     {
-        m_minSpeed = speed;
+        m_config->minSpeed = speed;
     }
     inline float getMaxSpeed() const
     {
-        return m_maxSpeed;
+        return m_config->maxSpeed;
     }
     inline void setMaxSpeed(float speed)
     {
-        m_maxSpeed = speed;
+        m_config->maxSpeed = speed;
     }
     inline float getMinLifetime() const
     {
-        return m_minLifetime;
+        return m_config->minLifetime;
     }
     inline void setMinLifetime(float lifetime)
     {
-        m_minLifetime = lifetime;
+        m_config->minLifetime = lifetime;
     }
     inline float getMaxLifetime() const
     {
-        return m_maxLifetime;
+        return m_config->maxLifetime;
     }
     inline void setMaxLifetime(float lifetime)
     {
-        m_maxLifetime = lifetime;
+        m_config->maxLifetime = lifetime;
     }
     inline float getMinSize() const
     {
-        return m_minSize;
+        return m_config->minSize;
     }
     inline void setMinSize(float size)
     {
-        m_minSize = size;
+        m_config->minSize = size;
     }
     inline float getMaxSize() const
     {
-        return m_maxSize;
+        return m_config->maxSize;
     }
     inline void setMaxSize(float size)
     {
-        m_maxSize = size;
+        m_config->maxSize = size;
     }
     inline float getEmissionRate() const
     {
-        return m_emissionRate;
+        return m_config->emissionRate;
     }
     inline void setEmissionRate(float rate)
     {
-        m_emissionRate = rate;
+        m_config->emissionRate = rate;
     }
     inline float getBurstCount() const
     {
-        return m_burstCount;
+        return m_config->burstCount;
     }
     inline void setBurstCount(float count)
     {
-        m_burstCount = count;
+        m_config->burstCount = count;
     }
     inline Color getStartColor() const
     {
-        return m_startColor;
+        return m_config->startColor;
     }
     inline void setStartColor(const Color& color)
     {
-        m_startColor = color;
+        m_config->startColor = color;
     }
     inline Color getEndColor() const
     {
-        return m_endColor;
+        return m_config->endColor;
     }
     inline void setEndColor(const Color& color)
     {
-        m_endColor = color;
+        m_config->endColor = color;
     }
     inline float getStartAlpha() const
     {
-        return m_startAlpha;
+        return m_config->startAlpha;
     }
     inline void setStartAlpha(float alpha)
     {
-        m_startAlpha = alpha;
+        m_config->startAlpha = alpha;
     }
     inline float getEndAlpha() const
     {
-        return m_endAlpha;
+        return m_config->endAlpha;
     }
     inline void setEndAlpha(float alpha)
     {
-        m_endAlpha = alpha;
+        m_config->endAlpha = alpha;
     }
     inline Vec2 getGravity() const
     {
-        return m_gravity;
+        return m_config->gravity;
     }
     inline void setGravity(const Vec2& grav)
     {
-        m_gravity = grav;
+        m_config->gravity = grav;
     }
     inline float getMinRotationSpeed() const
     {
-        return m_minRotationSpeed;
+        return m_config->minRotationSpeed;
     }
     inline void setMinRotationSpeed(float speed)
     {
-        m_minRotationSpeed = speed;
+        m_config->minRotationSpeed = speed;
     }
     inline float getMaxRotationSpeed() const
     {
-        return m_maxRotationSpeed;
+        return m_config->maxRotationSpeed;
     }
     inline void setMaxRotationSpeed(float speed)
     {
-        m_maxRotationSpeed = speed;
+        m_config->maxRotationSpeed = speed;
     }
     inline bool getFadeOut() const
     {
-        return m_fadeOut;
+        return m_config->fadeOut;
     }
     inline void setFadeOut(bool fade)
     {
-        m_fadeOut = fade;
+        m_config->fadeOut = fade;
     }
     inline bool getShrink() const
     {
-        return m_shrink;
+        return m_config->shrink;
     }
     inline void setShrink(bool shrinkEnabled)
     {
-        m_shrink = shrinkEnabled;
+        m_config->shrink = shrinkEnabled;
     }
     inline float getShrinkEndScale() const
     {
-        return m_shrinkEndScale;
+        return m_config->shrinkEndScale;
     }
     inline void setShrinkEndScale(float scale)
     {
-        m_shrinkEndScale = scale;
+        m_config->shrinkEndScale = scale;
     }
     inline int getMaxParticles() const
     {
-        return m_maxParticles;
+        return m_config->maxParticles;
     }
     inline void setMaxParticles(int max)
     {
-        m_maxParticles = max;
+        m_config->maxParticles = max;
     }
     inline Vec2 getPositionOffset() const
     {
-        return m_positionOffset;
+        return m_config->positionOffset;
     }
     inline void setPositionOffset(const Vec2& offset)
     {
-        m_positionOffset = offset;
+        m_config->positionOffset = offset;
     }
 
     // Emission shape configuration
     inline EmissionShape getEmissionShape() const
     {
-        return m_emissionShape;
+        return m_config->emissionShape;
     }
     inline void setEmissionShape(EmissionShape shape)
     {
-        m_emissionShape = shape;
+        m_config->emissionShape = shape;
     }
     inline float getShapeRadius() const
     {
-        return m_shapeRadius;
+        return m_config->shapeRadius;
     }
     inline void setShapeRadius(float radius)
     {
-        m_shapeRadius = radius;
+        m_config->shapeRadius = radius;
     }
     inline Vec2 getShapeSize() const
     {
-        return m_shapeSize;
+        return m_config->shapeSize;
     }
     inline void setShapeSize(const Vec2& size)
     {
-        m_shapeSize = size;
+        m_config->shapeSize = size;
     }
     inline Vec2 getLineStart() const
     {
-        return m_lineStart;
+        return m_config->lineStart;
     }
     inline void setLineStart(const Vec2& start)
     {
-        m_lineStart = start;
+        m_config->lineStart = start;
     }
     inline Vec2 getLineEnd() const
     {
-        return m_lineEnd;
+        return m_config->lineEnd;
     }
     inline void setLineEnd(const Vec2& end)
     {
-        m_lineEnd = end;
+        m_config->lineEnd = end;
     }
     inline bool getEmitFromEdge() const
     {
-        return m_emitFromEdge;
+        return m_config->emitFromEdge;
     }
     inline void setEmitFromEdge(bool edge)
     {
-        m_emitFromEdge = edge;
+        m_config->emitFromEdge = edge;
     }
     inline bool getEmitOutward() const
     {
-        return m_emitOutward;
+        return m_config->emitOutward;
     }
     inline void setEmitOutward(bool outward)
     {
-        m_emitOutward = outward;
+        m_config->emitOutward = outward;
     }
 
     // Polygon shape configuration
     inline const std::vector<Vec2>& getPolygonVertices() const
     {
-        return m_polygonVertices;
+        return m_config->polygonVertices;
     }
     inline void setPolygonVertices(const std::vector<Vec2>& vertices)
     {
-        m_polygonVertices = vertices;
+        m_config->polygonVertices = vertices;
     }
     inline void addPolygonVertex(const Vec2& vertex)
     {
-        m_polygonVertices.push_back(vertex);
+        m_config->polygonVertices.push_back(vertex);
     }
     inline void clearPolygonVertices()
     {
-        m_polygonVertices.clear();
+        m_config->polygonVertices.clear();
     }
 
     // Texture configuration (resource ownership stays in systems)
     inline const std::string& getTexturePath() const
     {
-        return m_texturePath;
+        return m_config->texturePath;
     }
     inline void setTexturePath(const std::string& path)
     {
-        m_texturePath = path;
+        m_config->texturePath = path;
+        m_textureHandle       = AssetHandles::intern(path);
+    }
+    /**
+     * @brief Interned texture path, refreshed by setTexturePath() and read by the renderer every frame
+     */
+    inline AssetHandle getTextureHandle() const
+    {
+        return m_textureHandle;
     }
 
     // Z-index for render ordering
@@ -372,50 +450,45 @@ public:
         m_emissionTimer = timer;
     }
 
-private:
-    bool m_enabled = true;  ///< Whether the emitter is active
-
-    // Configuration
-    Vec2  m_direction        = Vec2(0, 1);        ///< Base emission direction (normalized)
-    float m_spreadAngle      = 0.5f;              ///< Spread angle in radians (cone of emission)
-    float m_minSpeed         = 0.1f;              ///< Minimum initial speed (m/s)
-    float m_maxSpeed         = 0.3f;              ///< Maximum initial speed (m/s)
-    float m_minLifetime      = 1.0f;              ///< Minimum particle lifetime (seconds)
-    float m_maxLifetime      = 1.5f;              ///< Maximum particle lifetime (seconds)
-    float m_minSize          = 0.50f;             ///< Minimum particle size (meters)
-    float m_maxSize          = 0.50f;             ///< Maximum particle size (meters)
-    float m_emissionRate     = 10.0f;             ///< Particles per second
-    float m_burstCount       = 0.0f;              ///< Number of particles to emit in a burst
-    Color m_startColor       = Color::White;      ///< Starting color
-    Color m_endColor         = Color::Cyan;       ///< Ending color (for color interpolation)
-    float m_startAlpha       = 1.0f;              ///< Starting alpha
-    float m_endAlpha         = 1.0f;              ///< Ending alpha
-    Vec2  m_gravity          = Vec2(0, 0.2f);     ///< Gravity/constant acceleration (m/s²)
-    float m_minRotationSpeed = -1.0f;             ///< Minimum rotation speed (radians/second)
-    float m_maxRotationSpeed = 1.0f;              ///< Maximum rotation speed (radians/second)
-    bool  m_fadeOut          = true;              ///< Should particles fade out over lifetime?
-    bool  m_shrink           = true;              ///< Should particles shrink over lifetime?
-    float m_shrinkEndScale   = 0.1f;              ///< Final size scale when fully shrunk
-    int   m_maxParticles     = 200;               ///< Maximum number of particles
-    int   m_zIndex           = 0;                 ///< Render layer (lower = behind)
-    Vec2  m_positionOffset   = Vec2(0.0f, 0.0f);  ///< Offset from entity position
+    /**
+     * @brief World-space box around the live particles, including their size, as of the last SParticle update
+     * @return false if no particle was alive
+     */
+    inline bool getParticleBounds(Vec2& min, Vec2& max) const
+    {
+        if (!m_hasParticleBounds)
+        {
+            return false;
+        }
+        min = m_particleBoundsMin;
+        max = m_particleBoundsMax;
+        return true;
+    }
+    inline void setParticleBounds(const Vec2& min, const Vec2& max)
+    {
+        m_particleBoundsMin = min;
+        m_particleBoundsMax = max;
+        m_hasParticleBounds = true;
+    }
+    inline void clearParticleBounds()
+    {
+        m_hasParticleBounds = false;
+    }
 
-    // Emission shape configuration
-    EmissionShape     m_emissionShape = EmissionShape::Point;  ///< Shape for emission distribution
-    float             m_shapeRadius   = 1.0f;                  ///< Radius for circle shape (meters)
-    Vec2              m_shapeSize     = Vec2(1.0f, 1.0f);      ///< Size for rectangle shape (meters)
-    Vec2              m_lineStart     = Vec2(-0.5f, 0.0f);     ///< Start point for line shape
-    Vec2              m_lineEnd       = Vec2(0.5f, 0.0f);      ///< End point for line shape
-    std::vector<Vec2> m_polygonVertices;                       ///< Vertices for polygon shape
-    bool              m_emitFromEdge = true;                   ///< Emit from edge (true) or filled area (false)
-    bool              m_emitOutward  = false;                  ///< Emit in direction away from shape center
+private:
+    // Hot runtime state (touched every frame by SParticle/SRenderer, moved by swap-and-pop)
+    bool                  m_enabled           = true;   ///< Whether the emitter is active
+    int                   m_zIndex            = 0;      ///< Render layer (lower = behind)
+    float                 m_emissionTimer     = 0.0f;   ///< Time accumulator for continuous emission
+    std::vector<Particle> m_particles;                  ///< All particles (alive and dead)
+    Vec2                  m_particleBoundsMin;          ///< Lower corner of the live particles' box (meters)
+    Vec2                  m_particleBoundsMax;          ///< Upper corner of the live particles' box (meters)
+    bool                  m_hasParticleBounds = false;  ///< Whether any particle was alive at the last update
 
-    // Resources (by reference)
-    std::string m_texturePath;  ///< Optional texture path for particles
+    AssetHandle m_textureHandle = AssetHandles::kInvalid;  ///< Interned texturePath, read by the renderer
 
-    // Runtime state
-    std::vector<Particle> m_particles;             ///< All particles (alive and dead)
-    float                 m_emissionTimer = 0.0f;  ///< Time accumulator for continuous emission
+    // Cold configuration, kept out of the dense store behind a stable handle
+    ColdData<ParticleEmitterConfig> m_config;
 };
 
 }  // namespace Components
@@ -1,11 +1,25 @@
 #ifndef CSHADER_H
 #define CSHADER_H
 
+#include <cstdint>
 #include <string>
+#include <vector>
+#include "AssetHandle.h"
 
 namespace Components
 {
 
+/**
+ * @brief A custom uniform set on a CShader (float, vec2, vec3 or vec4)
+ */
+struct ShaderParameter
+{
+    std::string name;
+    AssetHandle nameHandle = AssetHandles::kInvalid;  ///< Interned name, used by the renderer
+    uint8_t     components = 1;                       ///< 1 for float up to 4 for vec4
+    float       value[4]   = {};
+};
+
 /**
  * @brief Component for shader resources
  *
@@ -14,6 +28,15 @@ namespace Components
  * paths to vertex and fragment shader files and acts as a reference for the
  * rendering system. The actual shader loading and compilation is handled by
  * the rendering system to avoid duplicate shader loads and improve performance.
+ *
+ * The pair of paths is interned to one AssetHandle whenever either path is
+ * set, so the renderer never builds or hashes the combined key per frame.
+ * The paths are private, so the setters are the only way to change them.
+ *
+ * Parameters are uploaded as uniforms next to the engine-wide u_time and
+ * u_resolution. The renderer only calls setUniform when a value differs from
+ * what the program already holds, so parameters that rarely change cost nothing
+ * per frame. Entities sharing a shader with equal parameters still batch.
  */
 struct CShader
 {
@@ -21,6 +44,7 @@ struct CShader
     CShader(const std::string& vertexPath, const std::string& fragmentPath)
         : vertexShaderPath(vertexPath), fragmentShaderPath(fragmentPath)
     {
+        updateHandle();
     }
 
     inline std::string getVertexShaderPath() const
@@ -30,6 +54,7 @@ struct CShader
     inline void setVertexShaderPath(const std::string& vertexPath)
     {
         vertexShaderPath = vertexPath;
+        updateHandle();
     }
     inline std::string getFragmentShaderPath() const
     {
@@ -38,10 +63,81 @@ struct CShader
     inline void setFragmentShaderPath(const std::string& fragmentPath)
     {
         fragmentShaderPath = fragmentPath;
+        updateHandle();
+    }
+    inline AssetHandle getShaderHandle() const
+    {
+        return shaderHandle;
     }
 
-    std::string vertexShaderPath;
-    std::string fragmentShaderPath;
+    /**
+     * @brief Sets a float, vec2, vec3 or vec4 uniform, replacing an earlier value of the same name
+     */
+    void setParameter(const std::string& name, float x)
+    {
+        assignParameter(name, 1, x, 0.0f, 0.0f, 0.0f);
+    }
+    void setParameter(const std::string& name, float x, float y)
+    {
+        assignParameter(name, 2, x, y, 0.0f, 0.0f);
+    }
+    void setParameter(const std::string& name, float x, float y, float z)
+    {
+        assignParameter(name, 3, x, y, z, 0.0f);
+    }
+    void setParameter(const std::string& name, float x, float y, float z, float w)
+    {
+        assignParameter(name, 4, x, y, z, w);
+    }
+    inline const std::vector<ShaderParameter>& getParameters() const
+    {
+        return parameters;
+    }
+    inline void clearParameters()
+    {
+        parameters.clear();
+    }
+
+private:
+    std::string                  vertexShaderPath;
+    std::string                  fragmentShaderPath;
+    AssetHandle                  shaderHandle = AssetHandles::kInvalid;  ///< Interned vertex|fragment path pair
+    std::vector<ShaderParameter> parameters;                             ///< Custom uniforms, in the order first set
+
+    void assignParameter(const std::string& name, uint8_t components, float x, float y, float z, float w)
+    {
+        ShaderParameter* parameter = nullptr;
+        for (ShaderParameter& existing : parameters)
+        {
+            if (existing.name == name)
+            {
+                parameter = &existing;
+                break;
+            }
+        }
+        if (!parameter)
+        {
+            parameter             = &parameters.emplace_back();
+            parameter->name       = name;
+            parameter->nameHandle = AssetHandles::intern(name);
+        }
+
+        parameter->components = components;
+        parameter->value[0]   = x;
+        parameter->value[1]   = y;
+        parameter->value[2]   = z;
+        parameter->value[3]   = w;
+    }
+
+    void updateHandle()
+    {
+        if (vertexShaderPath.empty() && fragmentShaderPath.empty())
+        {
+            shaderHandle = AssetHandles::kInvalid;
+            return;
+        }
+        shaderHandle = AssetHandles::intern(vertexShaderPath + "|" + fragmentShaderPath);
+    }
 };
 
 }  // namespace Components
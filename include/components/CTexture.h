@@ -2,6 +2,7 @@
 #define CTEXTURE_H
 
 #include <string>
+#include "AssetHandle.h"
 
 namespace Components
 {
@@ -14,11 +15,18 @@ namespace Components
  * path to the texture file and acts as a reference for the rendering system.
  * The actual texture loading and caching is handled by the rendering system
  * to avoid duplicate texture loads and improve performance.
+ *
+ * The path is interned to an AssetHandle when it is set, which the renderer
+ * uses to find the loaded texture each frame. Both are private so that
+ * setTexturePath() is the only way to change them and they never disagree.
  */
 struct CTexture
 {
     CTexture() = default;
-    explicit CTexture(const std::string& texturePath) : texturePath(texturePath) {}
+    explicit CTexture(const std::string& texturePath)
+        : texturePath(texturePath), textureHandle(AssetHandles::intern(texturePath))
+    {
+    }
 
     inline std::string getTexturePath() const
     {
@@ -26,10 +34,17 @@ struct CTexture
     }
     inline void setTexturePath(const std::string& newTexturePath)
     {
-        texturePath = newTexturePath;
+        texturePath   = newTexturePath;
+        textureHandle = AssetHandles::intern(newTexturePath);
+    }
+    inline AssetHandle getTextureHandle() const
+    {
+        return textureHandle;
     }
 
+private:
     std::string texturePath;
+    AssetHandle textureHandle = AssetHandles::kInvalid;  ///< Interned texturePath
 };
 
 }  // namespace Components
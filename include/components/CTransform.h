@@ -1,6 +1,7 @@
 #ifndef CTRANSFORM_H
 #define CTRANSFORM_H
 
+#include <cmath>
 #include <string>
 #include "Vec2.h"
 
@@ -15,11 +16,19 @@ namespace Components
  * position, velocity, scale, and rotation. It provides the basic functionality
  * for moving and transforming entities in the game world. The component is
  * updated each frame to apply velocity-based movement.
+ *
+ * Fixed-step systems (physics) call snapshot() before writing a new pose so the
+ * renderer can blend the previous and current poses with the engine's
+ * interpolation alpha. The setters snap: they move both poses, so explicit
+ * teleports are never smeared across a frame.
  */
 struct CTransform
 {
     CTransform() = default;
-    CTransform(const Vec2& pos, const Vec2& scl, float rot) : position(pos), scale(scl), rotation(rot) {}
+    CTransform(const Vec2& pos, const Vec2& scl, float rot)
+        : position(pos), scale(scl), rotation(rot), previousPosition(pos), previousRotation(rot)
+    {
+    }
 
     inline Vec2 getPosition() const
     {
@@ -40,7 +49,8 @@ struct CTransform
 
     inline void setPosition(const Vec2& pos)
     {
-        position = pos;
+        position         = pos;
+        previousPosition = pos;
     }
     inline void setVelocity(const Vec2& vel)
     {
@@ -52,13 +62,56 @@ struct CTransform
     }
     inline void setRotation(float rot)
     {
-        rotation = rot;
+        rotation         = rot;
+        previousRotation = rot;
+    }
+
+    /**
+     * @brief Records the current pose as the previous fixed-step pose and enables interpolation
+     */
+    inline void snapshot()
+    {
+        previousPosition = position;
+        previousRotation = rotation;
+        interpolate      = true;
+    }
+
+    /**
+     * @brief Position blended between the previous and current fixed-step poses
+     * @param alpha 0 = previous pose, 1 = current pose
+     */
+    inline Vec2 getInterpolatedPosition(float alpha) const
+    {
+        if (!interpolate)
+        {
+            return position;
+        }
+        return previousPosition + (position - previousPosition) * alpha;
+    }
+
+    /**
+     * @brief Rotation blended along the shortest arc between the previous and current poses
+     * @param alpha 0 = previous pose, 1 = current pose
+     */
+    inline float getInterpolatedRotation(float alpha) const
+    {
+        if (!interpolate)
+        {
+            return rotation;
+        }
+        const float delta = std::remainder(rotation - previousRotation, 6.28318530718f);
+        return previousRotation + delta * alpha;
     }
 
     Vec2  position = Vec2(0.0f, 0.0f);
     Vec2  velocity = Vec2(0.0f, 0.0f);
     Vec2  scale    = Vec2(1.0f, 1.0f);
     float rotation = 0.0f;
+
+    // Render interpolation state (written by fixed-step systems via snapshot())
+    Vec2  previousPosition = Vec2(0.0f, 0.0f);  ///< Position before the latest fixed step
+    float previousRotation = 0.0f;              ///< Rotation before the latest fixed step
+    bool  interpolate      = false;             ///< Whether a fixed-step system drives this transform
 };
 
 }  // namespace Components
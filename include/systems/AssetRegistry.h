@@ -0,0 +1,103 @@
+#pragma once
+
+#include <AssetHandle.h>
+#include <vector>
+
+namespace Systems
+{
+
+/**
+ * @brief Maps asset handles to loaded resources with a plain array index
+ *
+ * @description
+ * A slot is filled the first time its handle is resolved, by calling the given
+ * loader; after that, resolving the handle costs one bounds check and one index.
+ * A loader returning nullptr marks the asset as failed, so a missing file is
+ * reported once instead of on every frame. The registry does not own the
+ * resources; clear() forgets every slot so each asset is loaded again on its
+ * next use. Resource may be const-qualified for resources only read through
+ * the registry.
+ */
+template <typename Resource>
+class AssetRegistry
+{
+public:
+    /**
+     * @brief The resource for handle, calling load() if the handle was never resolved
+     * @param load Callable returning Resource* (nullptr on failure)
+     * @return nullptr for AssetHandles::kInvalid or a failed load
+     */
+    template <typename Loader>
+    Resource* resolve(AssetHandle handle, Loader&& load)
+    {
+        if (handle == AssetHandles::kInvalid)
+        {
+            return nullptr;
+        }
+
+        if (handle >= m_slots.size())
+        {
+            m_slots.resize(static_cast<size_t>(handle) + 1);
+        }
+
+        Slot& slot = m_slots[handle];
+        if (!slot.resolved)
+        {
+            slot.resource = load();
+            slot.resolved = true;
+        }
+        return slot.resource;
+    }
+
+    /**
+     * @brief Whether handle has been resolved, successfully or not
+     */
+    bool isResolved(AssetHandle handle) const
+    {
+        return handle < m_slots.size() && m_slots[handle].resolved;
+    }
+
+    /**
+     * @brief The resolved resource, or nullptr if the handle is unresolved or failed to load
+     */
+    Resource* get(AssetHandle handle) const
+    {
+        return handle < m_slots.size() ? m_slots[handle].resource : nullptr;
+    }
+
+    /**
+     * @brief Records the outcome of a load that finished elsewhere, such as a background decode
+     */
+    void set(AssetHandle handle, Resource* resource)
+    {
+        if (handle == AssetHandles::kInvalid)
+        {
+            return;
+        }
+
+        if (handle >= m_slots.size())
+        {
+            m_slots.resize(static_cast<size_t>(handle) + 1);
+        }
+        m_slots[handle] = Slot{resource, true};
+    }
+
+    /**
+     * @brief Forgets every resolved slot
+     */
+    void clear()
+    {
+        m_slots.clear();
+    }
+
+private:
+    struct Slot
+    {
+        Resource* resource = nullptr;
+        bool      resolved = false;
+    };
+
+    std::vector<Slot> m_slots;  ///< Indexed by handle
+};
+
+}  // namespace Systems
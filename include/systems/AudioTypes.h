@@ -21,6 +21,15 @@ enum class AudioType
     Music
 };
 
+/**
+ * @brief Where the audio system sends playback
+ */
+enum class AudioBackend
+{
+    Device,  ///< SFML/OpenAL output device
+    Null     ///< No device: sounds are tracked but never played (headless runs)
+};
+
 /**
  * @brief Audio system constants
  */
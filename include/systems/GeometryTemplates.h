@@ -0,0 +1,46 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+namespace Systems
+{
+
+/**
+ * @brief Precomputed shape geometry the renderer writes straight into RenderFrame vertices
+ *
+ * @description
+ * Circles are built from unit-circle point templates computed once per level
+ * of detail, so drawing one costs a transform per point instead of a sin and
+ * cos per point. The level is picked from the circle's radius on screen: the
+ * fewest segments that keep the outline within half a pixel of a true circle.
+ *
+ * Thick lines are written as a single quad, which batches with other
+ * triangle geometry, instead of one hairline per pixel of thickness.
+ */
+class GeometryTemplates
+{
+public:
+    static constexpr size_t kCircleLods[]     = {8, 16, 32, 64};  ///< Segment counts, coarsest first
+    static constexpr size_t kLineQuadVertices = 6;                ///< Vertices written by writeThickLine()
+
+    /**
+     * @brief Segment count of the level of detail for a circle of screenRadius pixels
+     */
+    static size_t circleSegments(float screenRadius);
+
+    /**
+     * @brief Points of a unit circle, starting at the top and going clockwise on screen
+     * @param segments A value returned by circleSegments()
+     * @return segments points
+     */
+    static const sf::Vector2f* unitCircle(size_t segments);
+
+    /**
+     * @brief Writes a line from start to end, thickness pixels wide, as two triangles
+     * @param out kLineQuadVertices vertices to fill
+     */
+    static void writeThickLine(sf::Vertex* out, sf::Vector2f start, sf::Vector2f end, float thickness, sf::Color color);
+};
+
+}  // namespace Systems
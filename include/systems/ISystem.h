@@ -1,5 +1,9 @@
 #pragma once
 
+#include <typeinfo>
+
+#include "SystemAccess.h"
+
 class World;
 
 namespace Systems
@@ -32,6 +36,27 @@ public:
         return false;
     }
 
+    /**
+     * @brief Step length in seconds for this system's fixed-timestep loop; 0 uses the engine default.
+     *
+     * Each fixed-step system keeps its own accumulator, so systems can tick at different rates.
+     */
+    virtual float fixedTimeStep() const
+    {
+        return 0.0f;
+    }
+
+    /**
+     * @brief Minimum seconds between update() calls; 0 updates every frame.
+     *
+     * A throttled system receives the time elapsed since its previous update as deltaTime.
+     * Ignored for fixed-timestep systems, which use fixedTimeStep() instead.
+     */
+    virtual float tickInterval() const
+    {
+        return 0.0f;
+    }
+
     /**
      * @brief Fixed-timestep update. Only called when usesFixedTimestep() is true.
      */
@@ -47,6 +72,26 @@ public:
     {
         return UpdateStage::PreFlush;
     }
+
+    /**
+     * @brief Declares the components this system touches so the scheduler can run it concurrently.
+     *
+     * The default is exclusive: a system that declares nothing never overlaps with another.
+     */
+    virtual void declareAccess(SystemAccess& access) const
+    {
+        access.exclusive();
+    }
+
+    /**
+     * @brief Name used for profiler scopes and diagnostics; must have static storage duration.
+     *
+     * Defaults to the (implementation-defined) RTTI name of the concrete type.
+     */
+    virtual const char* debugName() const
+    {
+        return typeid(*this).name();
+    }
 };
 
 }  // namespace Systems
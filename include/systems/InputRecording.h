@@ -0,0 +1,104 @@
+#pragma once
+
+#include <SFML/Window/Event.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Systems
+{
+
+/**
+ * @brief Input events SInput processed during one update, and that update's delta time
+ */
+struct RecordedInputFrame
+{
+    float                  deltaTime = 0.0f;
+    std::vector<sf::Event> events;
+};
+
+/**
+ * @brief A captured input session that SInput can replay frame by frame
+ *
+ * @description
+ * While SInput records into an InputRecording, every update() appends a frame
+ * holding its delta time and every event passed to SInput::processEvent() since
+ * the previous update(), whether polled from the window or injected. Replaying
+ * feeds the same events back through processEvent() one frame per update(), so
+ * key/mouse state, action states, listeners and controller components see
+ * exactly what the original session saw. Combined with
+ * GameEngine::replayInput() this reproduces a session headlessly, e.g. under the
+ * profiler.
+ *
+ * Only event types SInput handles are kept. The binary format stores each event
+ * in a few bytes (little-endian), so long sessions stay small.
+ */
+class InputRecording
+{
+public:
+    /**
+     * @brief Appends a frame
+     * @param deltaTime Delta time of the update the events were processed in
+     * @param events Events in processing order; types SInput ignores are dropped
+     */
+    void addFrame(float deltaTime, const std::vector<sf::Event>& events);
+
+    /**
+     * @brief Whether SInput handles this event type, and a recording therefore keeps it
+     */
+    static bool isRecordable(const sf::Event& event);
+
+    const std::vector<RecordedInputFrame>& getFrames() const
+    {
+        return m_frames;
+    }
+
+    size_t getFrameCount() const
+    {
+        return m_frames.size();
+    }
+
+    /**
+     * @brief Total events across all frames
+     */
+    size_t getEventCount() const;
+
+    /**
+     * @brief Sum of the recorded frame delta times, in seconds
+     */
+    double getDuration() const;
+
+    void clear()
+    {
+        m_frames.clear();
+    }
+
+    /**
+     * @brief Encodes the recording into the compact binary format
+     */
+    std::vector<uint8_t> serialize() const;
+
+    /**
+     * @brief Replaces this recording with one decoded from serialize() output
+     * @return false (leaving the recording empty) if the data is truncated or not a recording
+     */
+    bool deserialize(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Writes serialize() to a file
+     * @return false if the file could not be written
+     */
+    bool saveToFile(const std::string& path) const;
+
+    /**
+     * @brief Reads a file written by saveToFile()
+     * @return false if the file could not be read or decoded
+     */
+    bool loadFromFile(const std::string& path);
+
+private:
+    std::vector<RecordedInputFrame> m_frames;
+};
+
+}  // namespace Systems
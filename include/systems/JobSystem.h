@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Systems
+{
+
+/**
+ * @brief Tracks completion of a group of jobs
+ *
+ * Every job scheduled against a counter increments it and decrements it when
+ * it finishes. A counter can also gate other jobs: jobs scheduled with a
+ * counter as their dependency are held back until it reaches zero.
+ *
+ * The counter must outlive every job scheduled against it or depending on it;
+ * JobSystem::wait() is the usual way to guarantee that.
+ */
+class JobCounter
+{
+public:
+    JobCounter() = default;
+
+    JobCounter(const JobCounter&)            = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    /**
+     * @brief Whether every job tracked by this counter has finished
+     */
+    bool isDone() const
+    {
+        return m_pending.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<size_t>                m_pending{0};     ///< Jobs still queued or running
+    std::mutex                         m_mutex;          ///< Guards m_continuations
+    std::vector<std::function<void()>> m_continuations;  ///< Jobs waiting for this counter
+};
+
+/**
+ * @brief Work-stealing job scheduler shared by all engine systems
+ *
+ * @description
+ * Owns a fixed pool of worker threads, each with its own job deque. Workers pop
+ * their own newest job first and steal the oldest job from other deques when
+ * idle. Threads that are not workers (the main thread, loader threads) push into
+ * a shared injection deque.
+ *
+ * Jobs that must run on the main thread (SFML window/GL calls, ImGui) are queued
+ * separately and executed by runMainThreadJobs(), which GameEngine calls once
+ * per frame. Waiting from the main thread also drains that queue so a main-thread
+ * job can never deadlock a wait.
+ *
+ * Jobs must not throw; an escaping exception terminates the process.
+ */
+class JobSystem
+{
+public:
+    using Job      = std::function<void()>;
+    using RangeJob = std::function<void(size_t begin, size_t end)>;
+
+    /**
+     * @brief Starts the worker pool
+     * @param workerCount Number of worker threads; 0 picks hardware_concurrency - 1.
+     *        On a single-core machine that leaves no workers, and every job then runs
+     *        on the thread that waits for it.
+     */
+    explicit JobSystem(size_t workerCount = 0);
+
+    /** @brief Stops and joins all workers; queued jobs that never started are dropped */
+    ~JobSystem();
+
+    JobSystem(const JobSystem&)            = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Queues a job for any worker
+     * @param job Work to run
+     * @param counter Optional counter incremented now and decremented when the job finishes
+     * @param dependency Optional counter that must reach zero before the job may start
+     */
+    void schedule(Job job, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+    /**
+     * @brief Queues a job that only runs on the main thread
+     * @param job Work to run inside runMainThreadJobs() or a main-thread wait()
+     * @param counter Optional counter tracking the job
+     */
+    void scheduleMainThread(Job job, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Splits [0, count) into chunks and runs them across the pool, blocking until done
+     * @param count Number of items
+     * @param grainSize Items per chunk (0 picks a size giving a few chunks per thread)
+     * @param job Called with each [begin, end) chunk, possibly concurrently
+     *
+     * The calling thread processes chunks too, so this is safe to call from inside a job.
+     */
+    void parallelFor(size_t count, size_t grainSize, const RangeJob& job);
+
+    /**
+     * @brief Blocks until the counter reaches zero, running other jobs meanwhile
+     */
+    void wait(JobCounter& counter);
+
+    /**
+     * @brief Runs every main-thread job queued so far
+     * @return Number of jobs executed
+     *
+     * Must be called from the thread that constructed the JobSystem.
+     */
+    size_t runMainThreadJobs();
+
+    /**
+     * @brief Number of worker threads (excluding the main thread)
+     */
+    size_t getWorkerCount() const
+    {
+        return m_workers.size();
+    }
+
+    /**
+     * @brief Whether the calling thread is the one that constructed the JobSystem
+     */
+    bool isMainThread() const
+    {
+        return std::this_thread::get_id() == m_mainThreadId;
+    }
+
+private:
+    struct Task
+    {
+        Job         job;
+        JobCounter* counter = nullptr;
+    };
+
+    struct WorkQueue
+    {
+        std::mutex       mutex;
+        std::deque<Task> tasks;
+    };
+
+    void workerLoop(size_t queueIndex);
+    void enqueue(Task task);
+    bool tryRunOne(size_t queueIndex);
+    bool popOwn(size_t queueIndex, Task& out);
+    bool steal(size_t thiefIndex, Task& out);
+    void execute(Task& task);
+    void finish(JobCounter* counter);
+    void notifyWork();
+
+    static constexpr size_t kInjectionQueue = 0;  ///< Queue used by non-worker threads
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;        ///< [0] injection, [1..N] one per worker
+    std::vector<std::thread>                m_workers;       ///< Worker threads
+    std::thread::id                         m_mainThreadId;  ///< Thread that constructed the system
+
+    std::mutex       m_mainThreadMutex;  ///< Guards m_mainThreadJobs
+    std::deque<Task> m_mainThreadJobs;   ///< Jobs pinned to the main thread
+
+    std::mutex              m_sleepMutex;     ///< Paired with m_wake for idle workers
+    std::condition_variable m_wake;           ///< Signalled when work arrives or on shutdown
+    std::atomic<size_t>     m_queuedJobs{0};  ///< Jobs sitting in worker/injection queues
+    std::atomic<bool>       m_running{true};  ///< Cleared on destruction
+};
+
+}  // namespace Systems
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+#include "ShaderUniforms.h"
+
+namespace Systems
+{
+
+/**
+ * @brief A run of RenderFrame vertices drawn with a single draw call
+ */
+struct RenderBatch
+{
+    sf::PrimitiveType primitive    = sf::Triangles;  ///< How the vertices are assembled
+    sf::RenderStates  states;                        ///< Blend, texture, shader (transform is always identity)
+    size_t            firstVertex  = 0;              ///< Offset into RenderFrame::vertices
+    size_t            vertexCount  = 0;              ///< Vertices in the batch
+    ShaderUniforms*   uniforms     = nullptr;        ///< Uploads states.shader's uniforms before the draw
+    size_t            firstUniform = 0;              ///< Offset into RenderFrame::uniforms
+    size_t            uniformCount = 0;              ///< Custom uniform values of the batch
+};
+
+/**
+ * @brief The uniforms a draw needs set on its shader
+ */
+struct ShaderBinding
+{
+    ShaderUniforms*     uniforms   = nullptr;  ///< nullptr for unshaded draws
+    const UniformValue* values     = nullptr;  ///< Custom parameters, copied into the frame
+    size_t              valueCount = 0;
+};
+
+/**
+ * @brief A run of batches drawn into an offscreen texture instead of the window
+ */
+struct RenderPass
+{
+    sf::RenderTexture* target = nullptr;  ///< Recreated at size if needed, cleared to transparent, drawn, displayed
+    sf::Vector2u       size;              ///< Pixel size the target must have
+    sf::View           view;              ///< View the batches are drawn with
+    size_t             firstBatch   = 0;  ///< Offset into RenderFrame::batches
+    size_t             batchCount   = 0;  ///< Batches drawn into target rather than the window
+    size_t             firstVertex  = 0;  ///< Vertex count when the pass began
+    size_t             firstUniform = 0;  ///< Uniform count when the pass began
+};
+
+/**
+ * @brief Everything the renderer draws for one frame, detached from the World
+ *
+ * Built on the main thread by SRenderer::buildFrame() and drawn by
+ * SRenderer::submitFrame(), which may run on another thread while the next
+ * frame simulates. Textures and shaders are referenced from the renderer's
+ * caches and stay valid until those caches are cleared.
+ *
+ * Geometry is written in screen space into one shared vertex buffer. append()
+ * extends the previous batch whenever the new geometry uses the same primitive
+ * type, texture, shader and blend mode, so a run of similar sprites in draw
+ * order costs one draw call instead of one per entity. Only consecutive
+ * geometry is merged, which keeps z order exact. Shaded geometry also needs
+ * equal custom uniform values to merge.
+ *
+ * Geometry appended between beginPass() and endPass() is drawn into the pass's
+ * render texture before any window batch; batches never merge across a pass
+ * boundary.
+ */
+struct RenderFrame
+{
+    std::vector<sf::Vertex>   vertices;           ///< Screen-space geometry of every batch
+    std::vector<RenderBatch>  batches;            ///< Draws in z order
+    std::vector<UniformValue> uniforms;           ///< Custom uniform values referenced by batches
+    std::vector<RenderPass>   passes;             ///< Offscreen batch ranges, in batch order
+    float                     shaderTime = 0.0f;  ///< u_time for shaded draws
+    sf::Vector2f              resolution;         ///< u_resolution for shaded draws
+
+    /**
+     * @brief Drops all geometry and batches, keeping their capacity
+     */
+    void clear();
+
+    /**
+     * @brief Reserves vertexCount vertices drawn with primitive and states
+     * @param binding Uniforms to set on states.shader before drawing
+     * @return The reserved vertices, to be filled by the caller before the next append()
+     *
+     * Strip and fan primitives never merge, since joining them would connect
+     * unrelated shapes.
+     */
+    sf::Vertex* append(sf::PrimitiveType        primitive,
+                       const sf::RenderStates& states,
+                       size_t                  vertexCount,
+                       const ShaderBinding&    binding = ShaderBinding());
+
+    /**
+     * @brief Sends the following appends to target until endPass()
+     */
+    void beginPass(sf::RenderTexture* target, sf::Vector2u size, const sf::View& view);
+
+    /**
+     * @brief Ends the pass begun by beginPass(); later appends go to the window again
+     */
+    void endPass();
+
+    /**
+     * @brief Removes the last pass together with everything appended to it
+     */
+    void discardPass();
+
+    /**
+     * @brief Removes the last pass but keeps its batches, which are then drawn to the window
+     */
+    void dissolvePass();
+
+    /**
+     * @brief Whether a pass is open
+     */
+    bool inPass() const
+    {
+        return !passes.empty() && passes.back().batchCount == kOpenPass;
+    }
+
+private:
+    static constexpr size_t kOpenPass = static_cast<size_t>(-1);  ///< batchCount of a pass still being appended to
+
+    size_t m_firstMergeableBatch = 0;  ///< append() never extends batches before this one
+};
+
+}  // namespace Systems
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+#include "Entity.h"
+
+namespace Systems
+{
+
+/**
+ * @brief One renderable or particle emitter in draw order
+ */
+struct RenderQueueEntry
+{
+    Entity   entity;
+    bool     isParticleEmitter = false;
+    int      zIndex            = 0;
+    uint64_t batchKey          = 0;  ///< Render state identity reported by the renderer (0 = not yet drawn)
+};
+
+/**
+ * @brief Persistent draw order for SRenderer, kept across frames
+ *
+ * @description
+ * Entries live in buckets keyed by (zIndex, batchKey). Buckets are visited in
+ * ascending z and, within a z layer, by batch key, so draws sharing a texture,
+ * shader and blend mode sit next to each other and merge into one batch.
+ *
+ * The queue is reconciled once per frame: beginSync(), sync() for every entity
+ * that should be drawn, endSync(). An entity whose z is unchanged costs a
+ * single slot check; only inserts, z or batch-key changes and removals touch
+ * the buckets, so ordering work is proportional to what changed rather than a
+ * full sort of every renderable.
+ *
+ * Order within a bucket is insertion order, except that a removal moves the
+ * bucket's last entry into the freed place.
+ */
+class RenderQueue
+{
+public:
+    /**
+     * @brief Starts a reconciliation pass
+     */
+    void beginSync();
+
+    /**
+     * @brief Keeps the entity queued at zIndex, inserting or re-bucketing it as needed
+     * @param entity Entity to draw this frame
+     * @param isParticleEmitter Whether this is the entity's emitter rather than its renderable
+     * @param zIndex Current z index
+     * @param signature Hash of what decides the entry's pixels; a change is reported by changedInRange()
+     */
+    void sync(Entity entity, bool isParticleEmitter, int zIndex, uint64_t signature = 0);
+
+    /**
+     * @brief Drops every entry not synced since beginSync()
+     *
+     * Only buckets with fewer synced entries than they hold are scanned.
+     */
+    void endSync();
+
+    /**
+     * @brief Records the render state an entry was last drawn with
+     *
+     * Takes effect in the next each(); call it after iterating, not during.
+     */
+    void setBatchKey(Entity entity, bool isParticleEmitter, uint64_t batchKey);
+
+    /**
+     * @brief Visits entries in draw order
+     * @param fn Callable as fn(const RenderQueueEntry&)
+     */
+    template <typename Func>
+    void each(Func&& fn) const
+    {
+        visit(m_buckets.begin(), m_buckets.end(), fn);
+    }
+
+    /**
+     * @brief Visits, in draw order, the entries whose z index lies in [minZ, maxZ]
+     * @param fn Callable as fn(const RenderQueueEntry&)
+     */
+    template <typename Func>
+    void eachInRange(int minZ, int maxZ, Func&& fn) const
+    {
+        if (minZ > maxZ)
+        {
+            return;
+        }
+        visit(m_buckets.lower_bound(BucketKey(minZ, 0)),
+              m_buckets.upper_bound(BucketKey(maxZ, std::numeric_limits<uint64_t>::max())),
+              fn);
+    }
+
+    size_t size() const
+    {
+        return m_liveCount;
+    }
+
+    /**
+     * @brief Inserts, re-buckets and removals since the last beginSync()
+     */
+    size_t getChangeCount() const
+    {
+        return m_changeCount;
+    }
+
+    /**
+     * @brief Whether an entry entered, left, moved or changed signature within [minZ, maxZ] since the last beginSync()
+     *
+     * A move counts for both its old and its new z index.
+     */
+    bool changedInRange(int minZ, int maxZ) const;
+
+    void clear();
+
+private:
+    using BucketKey = std::pair<int, uint64_t>;  ///< (zIndex, batchKey)
+
+    struct Bucket
+    {
+        std::vector<uint32_t> slots;            ///< Slot indices in draw order
+        uint32_t              syncEpoch   = 0;  ///< Pass syncedCount was last reset in
+        uint32_t              syncedCount = 0;  ///< Slots synced in that pass
+    };
+
+    struct Slot
+    {
+        Entity   entity;
+        int      zIndex    = 0;
+        uint64_t batchKey  = 0;
+        uint64_t signature = 0;  ///< Signature passed to the last sync()
+        uint32_t position  = 0;        ///< Index within its bucket
+        uint32_t syncEpoch = 0;        ///< Last pass that synced this slot
+        Bucket*  bucket    = nullptr;  ///< Bucket holding the slot while live (map nodes never move)
+        bool     live      = false;
+    };
+
+    static uint32_t slotIndexOf(Entity entity, bool isParticleEmitter)
+    {
+        return entity.index * 2u + (isParticleEmitter ? 1u : 0u);
+    }
+
+    template <typename Iterator, typename Func>
+    void visit(Iterator begin, Iterator end, Func& fn) const
+    {
+        RenderQueueEntry entry;
+        for (Iterator it = begin; it != end; ++it)
+        {
+            entry.zIndex   = it->first.first;
+            entry.batchKey = it->first.second;
+            for (uint32_t slotIndex : it->second.slots)
+            {
+                entry.entity            = m_slots[slotIndex].entity;
+                entry.isParticleEmitter = (slotIndex & 1u) != 0;
+                fn(entry);
+            }
+        }
+    }
+
+    void recordChange(int zIndex);
+    void markSynced(Slot& slot);
+    void insert(uint32_t slotIndex, Entity entity, int zIndex, uint64_t batchKey);
+    void erase(uint32_t slotIndex);
+    void move(uint32_t slotIndex, int zIndex, uint64_t batchKey);
+
+    std::map<BucketKey, Bucket> m_buckets;          ///< Slots per (z, batch key), in draw order
+    std::vector<Slot>           m_slots;            ///< Indexed by entity index * 2 + emitter flag
+    uint32_t                    m_epoch       = 0;  ///< Current reconciliation pass
+    size_t                      m_liveCount   = 0;  ///< Queued entries
+    size_t                      m_syncedCount = 0;  ///< Live entries synced in the current pass
+    size_t                      m_changeCount = 0;  ///< Bucket changes in the current pass
+    std::vector<int>            m_changedZ;         ///< Z indices touched by the current pass's changes
+};
+
+}  // namespace Systems
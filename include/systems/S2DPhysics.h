@@ -75,13 +75,23 @@ public:
      * @brief Update the physics simulation
      * @param deltaTime Time elapsed since last update (not used - fixed timestep)
      */
-    void update(float deltaTime, World& world) override;
+    void        update(float deltaTime, World& world) override;
+    void        declareAccess(SystemAccess& access) const override;
+    const char* debugName() const override
+    {
+        return "S2DPhysics";
+    }
 
     bool usesFixedTimestep() const override
     {
         return true;
     }
 
+    float fixedTimeStep() const override
+    {
+        return m_timeStep;
+    }
+
     void fixedUpdate(float timeStep, World& world) override
     {
         (void)timeStep;
@@ -150,6 +160,21 @@ public:
         return m_subStepCount;
     }
 
+    /**
+     * @brief Number of bodies in the Box2D world
+     */
+    size_t getBodyCount() const;
+
+    /**
+     * @brief Number of shapes in the Box2D world
+     */
+    size_t getShapeCount() const;
+
+    /**
+     * @brief Wall time of the last Box2D world step, in milliseconds
+     */
+    float getLastStepMs() const;
+
     /**
      * @brief Create a Box2D body for an entity
      * @param entity Entity ID to associate with the body
@@ -5,6 +5,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "IAudioSystem.h"
 #include "System.h"
@@ -37,8 +38,10 @@ public:
     /**
      * @brief Construct audio system with specified pool size
      * @param poolSize Number of simultaneous sound effects (default 32)
+     * @param backend AudioBackend::Null never opens an audio device; loads and
+     *        play requests succeed for known ids but produce no sound
      */
-    explicit SAudio(size_t poolSize = AudioConstants::DEFAULT_SFX_POOL_SIZE);
+    explicit SAudio(size_t poolSize = AudioConstants::DEFAULT_SFX_POOL_SIZE, AudioBackend backend = AudioBackend::Device);
 
     /**
      * @brief Destructor - ensures proper cleanup
@@ -68,6 +71,19 @@ public:
     float getMasterVolume() const override;
     float getMusicVolume() const override;
 
+    /**
+     * @brief Backend selected at construction
+     */
+    AudioBackend getBackend() const
+    {
+        return m_backend;
+    }
+
+    /**
+     * @brief Number of SFX pool slots currently playing a sound
+     */
+    size_t getActiveSlotCount() const;
+
     void update(float deltaTime) override;
 
     // ISystem interface implementation
@@ -76,6 +92,11 @@ public:
     {
         return UpdateStage::PostFlush;
     }
+    void        declareAccess(SystemAccess& access) const override;
+    const char* debugName() const override
+    {
+        return "SAudio";
+    }
 
     /**
      * @brief ECS-driven audio update that consumes component data
@@ -108,10 +129,12 @@ private:
 
     void shutdownInternal();
 
+    AudioBackend                                     m_backend;
     bool                                             m_initialized = false;
     std::vector<SoundSlot>                           m_soundPool;
     std::unordered_map<std::string, sf::SoundBuffer> m_soundBuffers;
     std::unordered_map<std::string, std::string>     m_musicPaths;  ///< Map music IDs to file paths
+    std::unordered_set<std::string>                  m_nullSounds;  ///< SFX IDs loaded under the null backend
     std::unique_ptr<sf::Music>                       m_currentMusic;
     std::string                                      m_currentMusicId;
     float                                            m_currentMusicBaseVolume = 1.0f;
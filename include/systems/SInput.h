@@ -9,6 +9,7 @@
 #include "ActionBinding.h"
 #include "IInputListener.h"
 #include "InputEvents.h"
+#include "InputRecording.h"
 #include "MouseButton.h"
 #include "System.h"
 
@@ -44,6 +45,12 @@ private:
     std::vector<IInputListener*>                                           m_listenerPointers;
     ListenerId                                                             m_nextListenerId = 1;
 
+    // Session capture / playback
+    InputRecording*        m_recording   = nullptr;  ///< Receives a frame per update() while recording
+    std::vector<sf::Event> m_recordedEvents;         ///< Events processed since the last recorded frame
+    const InputRecording*  m_replay      = nullptr;  ///< Drives input instead of the window while replaying
+    size_t                 m_replayFrame = 0;        ///< Next recorded frame to feed
+
     // Helper to namespace actions per-entity so identical action names across entities don't collide
     std::string scopeAction(Entity entity, const std::string& actionName) const;
     void        registerControllerBindings(World& world);
@@ -62,7 +69,12 @@ public:
     void initialize(sf::RenderWindow* window, bool passToImGui = true);
     void shutdown();
 
-    void update(float deltaTime, World& world) override;
+    void        update(float deltaTime, World& world) override;
+    void        declareAccess(SystemAccess& access) const override;
+    const char* debugName() const override
+    {
+        return "SInput";
+    }
 
     ListenerId subscribe(std::function<void(const InputEvent&)> cb);
     void       unsubscribe(ListenerId id);
@@ -85,6 +97,31 @@ public:
     void        unbindAction(const std::string& actionName);                // remove all bindings
     ActionState getActionState(const std::string& actionName) const;
 
+    /**
+     * @brief Captures every processed event and each update's delta time into recording
+     *
+     * The recording must outlive the capture; call stopRecording() before destroying it.
+     */
+    void startRecording(InputRecording& recording);
+    void stopRecording();
+    bool isRecording() const
+    {
+        return m_recording != nullptr;
+    }
+
+    /**
+     * @brief Feeds recording back through processEvent(), one recorded frame per update()
+     *
+     * Window events are drained and discarded while replaying. Replay stops by itself
+     * after the last frame; the recording must stay alive until then.
+     */
+    void startReplay(const InputRecording& recording);
+    void stopReplay();
+    bool isReplaying() const
+    {
+        return m_replay != nullptr;
+    }
+
     // ImGui handling
     void setPassToImGui(bool pass)
     {
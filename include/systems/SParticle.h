@@ -6,10 +6,17 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <unordered_map>
+#include "AssetRegistry.h"
 #include "System.h"
+#include "TextureAtlas.h"
 
 class Registry;  // Forward declaration
 
+namespace Components
+{
+struct CParticleEmitter;
+}
+
 namespace Systems
 {
 
@@ -50,7 +57,12 @@ public:
      * @brief Updates all particle emitters on entities
      * @param deltaTime Time elapsed since last update
      */
-    void update(float deltaTime, World& world) override;
+    void        update(float deltaTime, World& world) override;
+    void        declareAccess(SystemAccess& access) const override;
+    const char* debugName() const override
+    {
+        return "SParticle";
+    }
 
     /**
      * @brief Renders particles for a single emitter entity
@@ -60,6 +72,39 @@ public:
      */
     void renderEmitter(Entity entity, sf::RenderWindow* window, World& world);
 
+    /**
+     * @brief Builds the screen-space triangles for a single emitter without drawing them
+     * @param entity Entity ID with CParticleEmitter component
+     * @param world World to access components
+     * @param vertices Cleared and filled with two triangles per alive particle
+     * @return Texture the triangles sample from, or nullptr for untextured particles
+     *
+     * The emitter's texture comes from this system's own cache, looked up by its texture handle.
+     */
+    const sf::Texture* buildEmitterVertices(Entity entity, World& world, sf::VertexArray& vertices);
+
+    /**
+     * @brief Builds an emitter's triangles sampling region, which the caller resolved from the emitter's texture handle
+     * @param region Atlas region to sample, or nullptr to leave the particles untextured
+     */
+    void buildEmitterVertices(Entity entity, World& world, const TextureRegion* region, sf::VertexArray& vertices);
+
+    /**
+     * @brief Screen-space box around an emitter's live particles, at the scale its quads are built with
+     * @param entity Entity ID with CParticleEmitter component
+     * @param world World to access components
+     * @return false if the emitter has no live particles
+     */
+    bool getEmitterScreenBounds(Entity entity, World& world, sf::Vector2f& min, sf::Vector2f& max) const;
+
+    /**
+     * @brief Rendering scale given to initialize()
+     */
+    float getPixelsPerMeter() const
+    {
+        return m_pixelsPerMeter;
+    }
+
     /**
      * @brief Checks if the particle system is initialized
      * @return true if initialized, false otherwise
@@ -69,6 +114,14 @@ public:
         return m_initialized;
     }
 
+    /**
+     * @brief Particles alive across all active emitters after the last update()
+     */
+    size_t getLiveParticleCount() const
+    {
+        return m_liveParticleCount;
+    }
+
 private:
     /** @brief Deleted copy constructor */
     SParticle(const SParticle&) = delete;
@@ -92,12 +145,21 @@ private:
 
     const sf::Texture* loadTexture(const std::string& filepath);
 
-    sf::VertexArray   m_vertexArray;     ///< Vertex array for rendering
-    sf::RenderWindow* m_window;          ///< Render window reference
-    float             m_pixelsPerMeter;  ///< Rendering scale
-    bool              m_initialized;     ///< Initialization state
+    /**
+     * @brief Appends two triangles per alive particle, with texture coordinates spanning texRect
+     */
+    void appendParticles(const ::Components::CParticleEmitter& emitter,
+                         const sf::FloatRect&                  texRect,
+                         sf::VertexArray&                      vertices) const;
+
+    sf::VertexArray   m_vertexArray;            ///< Vertex array for rendering
+    sf::RenderWindow* m_window;                 ///< Render window reference
+    float             m_pixelsPerMeter;         ///< Rendering scale
+    bool              m_initialized;            ///< Initialization state
+    size_t            m_liveParticleCount = 0;  ///< Counted by update()
 
     std::unordered_map<std::string, sf::Texture> m_textureCache;
+    AssetRegistry<const sf::Texture>             m_textures;  ///< Emitter texture handle to its entry in m_textureCache
 };
 
 }  // namespace Systems
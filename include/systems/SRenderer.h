@@ -2,17 +2,27 @@
 #define SRENDERER_H
 
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include "AssetRegistry.h"
 #include "Color.h"
+#include "RenderFrame.h"
+#include "RenderQueue.h"
 #include "System.h"
+#include "TextureAtlas.h"
+#include "TextureStreamer.h"
 
 class World;
 
 namespace Components
 {
 enum class BlendMode;
+struct CShader;
 }
 
 namespace Systems
@@ -30,8 +40,9 @@ struct WindowConfig
     std::string  title        = "Game Engine";  ///< Window title
     bool         fullscreen   = false;          ///< Fullscreen mode flag
     bool         vsync        = true;           ///< Vertical sync flag
-    unsigned int frameLimit   = 0;              ///< Frame rate limit (0 = unlimited)
+    unsigned int frameLimit   = 0;              ///< Frame rate GameEngine paces to (0 = unlimited)
     unsigned int antialiasing = 0;              ///< Anti-aliasing level (0, 2, 4, 8, 16)
+    bool         headless     = false;          ///< No window, rendering or audio device (GameEngine only)
 
     /**
      * @brief Gets SFML window style flags based on configuration
@@ -58,6 +69,23 @@ struct WindowConfig
     }
 };
 
+/**
+ * @brief Counters describing the most recently built and submitted frame
+ */
+struct RenderStats
+{
+    size_t queueLength       = 0;  ///< Visible renderables and particle emitters in the render queue
+    size_t queueChanges      = 0;  ///< Queue entries inserted, re-bucketed or removed by the last buildFrame()
+    size_t culledRenderables = 0;  ///< Queued renderables skipped for lying outside the view
+    size_t culledEmitters    = 0;  ///< Queued emitters skipped because their particles lie outside the view
+    size_t batches           = 0;  ///< Batches the last buildFrame() merged the queue into
+    size_t vertices          = 0;  ///< Vertices written by the last buildFrame()
+    size_t drawCalls         = 0;  ///< Window draw calls made by the last submitFrame()
+    size_t particleVertices  = 0;  ///< Vertices built for particle emitters
+    size_t cachedRenderables = 0;  ///< Queue entries drawn from a static layer's cached texture
+    size_t layerRebuilds     = 0;  ///< Static layers re-rasterized by the last frame
+};
+
 /**
  * @brief Rendering system that manages SFML window and draws entities
  *
@@ -105,13 +133,42 @@ public:
     /**
      * @brief Renders all entities to the window
      *
-     * Performs the following steps:
-     * 1. Clears the window
-     * 2. Sorts entities by z-index
-     * 3. Draws each visible entity using its components
-     * 4. Displays the frame
+     * Records the world with buildFrame() and draws it right away with
+     * submitFrame(). Clearing and displaying stay with the caller.
+     *
+     * @param interpolationAlpha Blend between each interpolated transform's previous
+     *        and current fixed-step pose (1 = current pose)
+     */
+    void render(World& world, float interpolationAlpha = 1.0f);
+
+    /**
+     * @brief Records the current world into a frame without drawing anything
+     * @param world World to read renderables, emitters and transforms from
+     * @param interpolationAlpha Transform blend, as for render()
+     * @param frame Cleared and filled with this frame's batched geometry
+     *
+     * Renderables whose bounds and emitters whose particle box fall outside the
+     * window's current view are skipped and counted in getStats().
+     *
+     * Must run on the main thread, while no system is writing the world.
+     */
+    void buildFrame(World& world, float interpolationAlpha, RenderFrame& frame);
+
+    /**
+     * @brief Draws a frame recorded by buildFrame() to the window
+     * @param frame Frame to draw; must not be rebuilt until this returns
+     *
+     * Touches GL state beyond the window: it creates, resizes and draws into the
+     * render textures of static layers being rebuilt, and sets uniforms on the
+     * shaders of shaded batches, which the shader cache owns.
+     *
+     * It may run on a worker thread as long as the window's GL context is active
+     * there and, until it returns, nothing else draws, uploadPendingAssets() does
+     * not run, and the texture cache, shader cache and static layers are not
+     * cleared. buildFrame() may run meanwhile: it never creates a texture or a
+     * shader, it only queues them for uploadPendingAssets().
      */
-    void render(World& world);
+    void submitFrame(const RenderFrame& frame);
 
     /**
      * @brief Clears the window with a specified color
@@ -155,7 +212,58 @@ public:
     const sf::Shader* loadShader(const std::string& vertexPath, const std::string& fragmentPath);
 
     /**
-     * @brief Clears the texture cache
+     * @brief Starts loading a texture before any entity uses it
+     * @param filepath Path a CTexture will reference
+     *
+     * The file is decoded on a job worker (or right away with async loading off)
+     * and uploaded by a later uploadPendingAssets().
+     */
+    void preloadTexture(const std::string& filepath);
+
+    /**
+     * @brief Decode CTexture images on job workers instead of the frame that first draws them (on by default)
+     *
+     * While a texture is loading, its entities draw untextured: shapes in their
+     * color and sprites as the fallback rectangle. With it off, images are decoded
+     * on the thread that first draws them, and still uploaded by the next
+     * uploadPendingAssets().
+     */
+    void setAsyncTextureLoading(bool enabled)
+    {
+        m_asyncTextureLoading = enabled;
+    }
+
+    /**
+     * @brief Time uploadPendingAssets() may spend uploading textures per call (at least one upload per call)
+     */
+    void setTextureUploadBudget(float milliseconds)
+    {
+        m_textureUploadBudgetMs = milliseconds;
+    }
+
+    /**
+     * @brief Compiles shaders and uploads decoded textures that buildFrame() queued, within the upload budget
+     *
+     * render() calls this before recording. Callers driving buildFrame() and
+     * submitFrame() themselves must call it on the main thread while no frame is
+     * being submitted: it writes atlas pages such a frame may be sampling from.
+     * Entities see the new textures and shaders from the next buildFrame() on.
+     */
+    void uploadPendingAssets();
+
+    /**
+     * @brief Textures still decoding or waiting for upload
+     */
+    size_t getPendingTextureCount() const
+    {
+        return m_textureStreamer.getPendingCount();
+    }
+
+    /**
+     * @brief Clears the texture cache and the texture atlas
+     *
+     * Waits for textures still decoding and drops them. Invalidates textures
+     * referenced by any RenderFrame still being submitted.
      */
     void clearTextureCache();
 
@@ -165,13 +273,63 @@ public:
     void clearShaderCache();
 
     /**
-     * @brief Inject particle system for particle rendering
+     * @brief Counters of the last buildFrame() / submitFrame()
+     *
+     * Safe to call from the main thread while a render job is submitting.
+     */
+    RenderStats getStats() const;
+
+    /**
+     * @brief Textures used by CTexture components and particle emitters, packed into shared pages
      */
-    void setParticleSystem(SParticle* particleSystem)
+    TextureAtlas& getTextureAtlas()
     {
-        m_particleSystem = particleSystem;
+        return m_textureAtlas;
     }
 
+    /**
+     * @brief Inject particle system for particle rendering
+     *
+     * Emitter textures are then resolved by handle through this renderer's atlas, like CTexture.
+     */
+    void setParticleSystem(SParticle* particleSystem);
+
+    /**
+     * @brief Marks the z indices minZ..maxZ (inclusive) as a static layer
+     * @return false if the range is empty or overlaps an existing static layer
+     *
+     * A static layer is rasterized into a window-sized render texture, which is
+     * then drawn as a single quad each frame without recording its entities. It is
+     * rasterized again when an entity enters, leaves or changes z within the range,
+     * when one of its entities is moved, recolored, retextured or reshaded, when
+     * the view or window size changes, when a streamed texture arrives, or after
+     * invalidateStaticLayer().
+     *
+     * Layers holding particle emitters, shaded draws or blend modes other than
+     * alpha blending are drawn directly instead.
+     */
+    bool addStaticLayer(int minZ, int maxZ);
+
+    /**
+     * @brief Forces every static layer to be redrawn next frame
+     */
+    void invalidateStaticLayers();
+
+    /**
+     * @brief Forces the static layer containing zIndex, if any, to be redrawn next frame
+     *
+     * Edits to an entity's transform, renderable, material, texture, shader or box
+     * collider are noticed on their own; call this for anything else its pixels depend on.
+     */
+    void invalidateStaticLayer(int zIndex);
+
+    /**
+     * @brief Removes every static layer and releases their render textures
+     *
+     * Invalidates textures referenced by any RenderFrame still being submitted.
+     */
+    void clearStaticLayers();
+
 private:
     /** @brief Deleted copy constructor */
     SRenderer(const SRenderer&) = delete;
@@ -180,11 +338,88 @@ private:
     SRenderer& operator=(const SRenderer&) = delete;
 
     /**
-     * @brief Renders a single entity
+     * @brief Writes the geometry of a single entity into the frame's batches
      * @param entity Entity ID to render
-     * @param registry Registry to access components
+     * @param world World to access components
+     * @param frame Frame the geometry is appended to
+     * @return Batch key of the render state used, or 0 if nothing was drawn
+     */
+    uint64_t renderEntity(Entity entity, World& world, RenderFrame& frame);
+
+    /**
+     * @brief Whether a draw's screen-space bounding circle misses the view; counts the draw as culled if so
+     */
+    bool cullDraw(sf::Vector2f center, float radius);
+
+    /**
+     * @brief Whether an emitter's particle box misses the view; counts the emitter as culled if so
+     */
+    bool cullEmitter(Entity entity, World& world);
+
+    /**
+     * @brief Atlas region of a CTexture or emitter texture handle, or nullptr while loading or after a failed load
+     */
+    const TextureRegion* resolveTexture(AssetHandle handle);
+
+    /**
+     * @brief Uniforms of a CShader's program, or nullptr until uploadPendingAssets() compiled it or if it failed
+     */
+    ShaderUniforms* resolveShader(const ::Components::CShader& shaderComp);
+
+    /**
+     * @brief Loads a shader program and creates the object that uploads its uniforms
+     * @return nullptr if the shader failed to load
+     */
+    ShaderUniforms* createShaderUniforms(const std::string& vertexPath, const std::string& fragmentPath);
+
+    /**
+     * @brief A shader first drawn by buildFrame(), compiled by the next uploadPendingAssets()
+     */
+    struct PendingShader
+    {
+        AssetHandle handle = AssetHandles::kInvalid;
+        std::string vertexPath;
+        std::string fragmentPath;
+    };
+
+    /**
+     * @brief A z range drawn from a render texture while its geometry stays the same
+     */
+    struct StaticLayer
+    {
+        int                                minZ;
+        int                                maxZ;
+        std::unique_ptr<sf::RenderTexture> texture;
+        sf::Vector2u                       windowSize;         ///< Window size when last recorded
+        std::array<float, 9>               viewState{};        ///< View when last recorded
+        bool                               dirty     = false;  ///< Must be recorded again next frame
+        bool                               valid     = false;  ///< texture holds the layer's current pixels
+        bool                               cacheable = true;   ///< Nothing in the layer prevents caching
+        bool                               failed    = false;  ///< texture could not be created; drawn directly
+    };
+
+    /**
+     * @brief Whether zIndex lies in a static layer, whose entries then need a render signature
      */
-    void renderEntity(Entity entity, World& world);
+    bool isInStaticLayer(int zIndex) const;
+
+    /**
+     * @brief Blits a static layer's texture when it is current, or records the layer into it or the window
+     * @param drawEntry Records one queue entry into frame
+     */
+    template <typename Func>
+    void buildStaticLayer(StaticLayer& layer, RenderFrame& frame, Func& drawEntry);
+
+    /**
+     * @brief Appends the quad that draws a static layer's texture over the view
+     */
+    void appendLayerBlit(const StaticLayer& layer, RenderFrame& frame, const sf::View& view, sf::Vector2u windowSize);
+
+    /**
+     * @brief Draws frame.batches[first, last) to target
+     * @return Draw calls made
+     */
+    size_t drawBatches(sf::RenderTarget& target, const RenderFrame& frame, size_t first, size_t last);
 
     /**
      * @brief Converts engine BlendMode to SFML BlendMode
@@ -196,8 +431,38 @@ private:
     std::unique_ptr<sf::RenderWindow>            m_window;                       ///< The render window
     std::unordered_map<std::string, sf::Texture> m_textureCache;                 ///< Cached textures by filepath
     std::unordered_map<std::string, std::unique_ptr<sf::Shader>> m_shaderCache;  ///< Cached shaders by filepath combination
-    bool       m_initialized    = false;                                         ///< Initialization state
-    SParticle* m_particleSystem = nullptr;                                       ///< Optional particle system hookup
+    bool            m_initialized        = false;                                ///< Initialization state
+    SParticle*      m_particleSystem     = nullptr;                              ///< Optional particle system hookup
+    float           m_interpolationAlpha = 1.0f;                                 ///< Transform blend for the frame being rendered
+    sf::Clock       m_shaderClock;                                               ///< Source of the u_time uniform
+    RenderFrame     m_frame;                                                     ///< Reused by render() for immediate drawing
+    sf::VertexArray m_particleScratch;                                           ///< Emitter vertices before they join a batch
+    RenderQueue     m_renderQueue;                                               ///< Draw order, kept across frames
+    TextureAtlas    m_textureAtlas;                                              ///< Textures of CTexture components and particles
+    TextureStreamer m_textureStreamer{m_textureAtlas};                           ///< Decodes CTexture images on job workers
+    sf::FloatRect   m_viewBounds;                                                ///< Screen area visible in the frame being built
+
+    AssetRegistry<const TextureRegion>           m_textureAssets;                 ///< CTexture handle to atlas region
+    AssetRegistry<ShaderUniforms>                m_shaderAssets;                  ///< CShader handle to its shader's uniforms
+    std::vector<std::unique_ptr<ShaderUniforms>> m_shaderUniforms;                ///< One per loaded shader
+    std::vector<PendingShader>                   m_pendingShaders;                ///< Waiting for uploadPendingAssets()
+    std::vector<UniformValue>                    m_uniformScratch;                ///< Parameters of the entity being drawn
+    bool                                         m_asyncTextureLoading   = true;  ///< Decode new textures on job workers
+    float                                        m_textureUploadBudgetMs = 2.0f;  ///< Upload time allowed per buildFrame()
+    std::vector<StaticLayer>                     m_staticLayers;                  ///< Sorted by minZ, never overlapping
+    std::mutex                                   m_failedLayerMutex;              ///< Guards m_failedLayerTargets
+    std::vector<const sf::RenderTexture*>        m_failedLayerTargets;            ///< Reported by submitFrame()
+
+    size_t              m_lastQueueLength       = 0;  ///< Render queue size of the last buildFrame()
+    size_t              m_lastQueueChanges      = 0;  ///< Render queue changes of the last buildFrame()
+    size_t              m_lastParticleVertices  = 0;  ///< Particle vertices of the last buildFrame()
+    size_t              m_lastBatches           = 0;  ///< Batch count of the last buildFrame()
+    size_t              m_lastVertices          = 0;  ///< Vertex count of the last buildFrame()
+    size_t              m_lastCulledRenderables = 0;  ///< Renderables culled by the last buildFrame()
+    size_t              m_lastCulledEmitters    = 0;  ///< Emitters culled by the last buildFrame()
+    size_t              m_lastCachedRenderables = 0;  ///< Queue entries drawn from static layer caches
+    size_t              m_lastLayerRebuilds     = 0;  ///< Static layers re-rasterized by the last buildFrame()
+    std::atomic<size_t> m_lastDrawCalls{0};           ///< Written by submitFrame(), possibly on a worker
 };
 
 }  // namespace Systems
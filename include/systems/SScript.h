@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "System.h"
 
 namespace Systems
@@ -7,11 +9,23 @@ namespace Systems
 
 /**
  * @brief Runs per-entity native scripts (behaviours) stored in Components::CNativeScript.
+ *
+ * Scripts with an updateInterval above 1 are assigned consecutive buckets as they are
+ * created, so only about 1/updateInterval of them update in any given frame.
  */
 class SScript : public System
 {
 public:
-    void update(float deltaTime, World& world) override;
+    void        update(float deltaTime, World& world) override;
+    void        declareAccess(SystemAccess& access) const override;
+    const char* debugName() const override
+    {
+        return "SScript";
+    }
+
+private:
+    uint64_t m_frame      = 0;  ///< Updates run so far, selects the bucket due this frame
+    uint32_t m_nextBucket = 0;  ///< Bucket handed to the next created script
 };
 
 }  // namespace Systems
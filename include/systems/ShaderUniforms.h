@@ -0,0 +1,86 @@
+#pragma once
+
+#include <AssetHandle.h>
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Systems
+{
+
+/**
+ * @brief One custom uniform value carried by a RenderFrame (float up to vec4)
+ */
+struct UniformValue
+{
+    AssetHandle name       = AssetHandles::kInvalid;  ///< Interned uniform name
+    uint8_t     components = 1;                       ///< 1 for float up to 4 for vec4
+    float       value[4]   = {};
+
+    bool operator==(const UniformValue& other) const;
+    bool operator!=(const UniformValue& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @brief Uploads a shader's uniforms, skipping values the program already holds
+ *
+ * @description
+ * sf::Shader::setUniform() binds the program and looks the location up by name
+ * on every call. ShaderUniforms remembers what it last uploaded and only calls
+ * it for values that changed: u_time and u_resolution at most once per frame,
+ * and custom parameters only when a draw needs different values than the
+ * previous draw with the same shader.
+ *
+ * Only the thread that submits frames may call apply() and applyFrame().
+ */
+class ShaderUniforms
+{
+public:
+    explicit ShaderUniforms(sf::Shader& shader) : m_shader(shader) {}
+
+    const sf::Shader* getShader() const
+    {
+        return &m_shader;
+    }
+
+    /**
+     * @brief Uploads the engine-wide uniforms if they differ from the last upload
+     */
+    void applyFrame(float time, sf::Vector2f resolution);
+
+    /**
+     * @brief Uploads the values that differ from the last upload of the same name
+     */
+    void apply(const UniformValue* values, size_t count);
+
+    /**
+     * @brief setUniform calls made so far
+     */
+    size_t getUploadCount() const
+    {
+        return m_uploadCount;
+    }
+
+private:
+    struct Uploaded
+    {
+        const std::string* name = nullptr;  ///< From AssetHandles::keyOf(), looked up once
+        UniformValue       value;
+    };
+
+    void upload(const std::string& name, const UniformValue& value);
+
+    sf::Shader&           m_shader;
+    bool                  m_hasFrameUniforms = false;  ///< u_time and u_resolution uploaded at least once
+    float                 m_time             = 0.0f;   ///< Last uploaded u_time
+    sf::Vector2f          m_resolution;                ///< Last uploaded u_resolution
+    std::vector<Uploaded> m_uploaded;                  ///< Last value of each custom uniform
+    size_t                m_uploadCount = 0;
+};
+
+}  // namespace Systems
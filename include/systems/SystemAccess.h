@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <typeindex>
+#include <vector>
+
+namespace Systems
+{
+
+/**
+ * @brief Component access a system declares so the scheduler can run it alongside others
+ *
+ * Two systems conflict when either is exclusive, or when one writes a component
+ * type the other reads or writes. Conflicting systems keep their registration
+ * order; non-conflicting systems in the same stage may run concurrently.
+ *
+ * @code
+ * void declareAccess(SystemAccess& access) const override
+ * {
+ *     access.reads<Components::CTransform>().writes<Components::CParticleEmitter>();
+ * }
+ * @endcode
+ */
+class SystemAccess
+{
+public:
+    /**
+     * @brief Declares read-only access to the given component types
+     */
+    template <typename... Components>
+    SystemAccess& reads()
+    {
+        (addUnique(m_reads, std::type_index(typeid(Components))), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Declares read/write access to the given component types
+     */
+    template <typename... Components>
+    SystemAccess& writes()
+    {
+        (addUnique(m_writes, std::type_index(typeid(Components))), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Marks the system as touching arbitrary state (user callbacks, structural changes)
+     *
+     * Exclusive systems never overlap with any other system in their stage.
+     */
+    SystemAccess& exclusive()
+    {
+        m_exclusive = true;
+        return *this;
+    }
+
+    /**
+     * @brief Pins the system to the main thread (window, GL or other thread-affine APIs)
+     */
+    SystemAccess& mainThread()
+    {
+        m_mainThread = true;
+        return *this;
+    }
+
+    bool isExclusive() const
+    {
+        return m_exclusive;
+    }
+
+    bool requiresMainThread() const
+    {
+        return m_mainThread;
+    }
+
+    const std::vector<std::type_index>& getReads() const
+    {
+        return m_reads;
+    }
+
+    const std::vector<std::type_index>& getWrites() const
+    {
+        return m_writes;
+    }
+
+    /**
+     * @brief Whether two systems must not run at the same time
+     */
+    bool conflictsWith(const SystemAccess& other) const
+    {
+        if (m_exclusive || other.m_exclusive)
+        {
+            return true;
+        }
+
+        for (const auto& type : m_writes)
+        {
+            if (contains(other.m_writes, type) || contains(other.m_reads, type))
+            {
+                return true;
+            }
+        }
+        for (const auto& type : other.m_writes)
+        {
+            if (contains(m_reads, type))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static bool contains(const std::vector<std::type_index>& types, const std::type_index& type)
+    {
+        return std::find(types.begin(), types.end(), type) != types.end();
+    }
+
+    static void addUnique(std::vector<std::type_index>& types, const std::type_index& type)
+    {
+        if (!contains(types, type))
+        {
+            types.push_back(type);
+        }
+    }
+
+    std::vector<std::type_index> m_reads;               ///< Component types read
+    std::vector<std::type_index> m_writes;              ///< Component types written
+    bool                         m_exclusive  = false;  ///< Conflicts with every other system
+    bool                         m_mainThread = false;  ///< Must run on the main thread
+};
+
+}  // namespace Systems
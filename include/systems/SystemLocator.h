@@ -9,6 +9,7 @@ class S2DPhysics;
 class SRenderer;
 class SParticle;
 class SAudio;
+class JobSystem;
 
 class SystemLocator
 {
@@ -18,18 +19,21 @@ public:
     static void provideRenderer(SRenderer* renderer);
     static void provideParticle(SParticle* particle);
     static void provideAudio(SAudio* audio);
+    static void provideJobs(JobSystem* jobs);
 
     static SInput&     input();
     static S2DPhysics& physics();
     static SRenderer&  renderer();
     static SParticle&  particle();
     static SAudio&     audio();
+    static JobSystem&  jobs();
 
     static SInput*     tryInput();
     static S2DPhysics* tryPhysics();
     static SRenderer*  tryRenderer();
     static SParticle*  tryParticle();
     static SAudio*     tryAudio();
+    static JobSystem*  tryJobs();
 };
 
 }  // namespace Systems
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "ISystem.h"
+
+namespace Systems
+{
+
+class JobSystem;
+
+/**
+ * @brief Orders systems per update stage and runs non-conflicting ones concurrently
+ *
+ * @description
+ * Systems are registered in the order they should run. For each UpdateStage the
+ * scheduler builds a dependency graph: a system depends on every earlier system
+ * in the same stage whose SystemAccess conflicts with its own. Systems without
+ * a path between them in that graph are dispatched on the JobSystem in parallel;
+ * systems that require the main thread are queued as main-thread jobs.
+ *
+ * Without a job system (or with no worker threads) stages run serially in
+ * registration order, which is exactly the order the graph preserves.
+ */
+class SystemScheduler
+{
+public:
+    using RunFn = std::function<void(ISystem& system)>;
+
+    /**
+     * @brief Appends a system to the end of its stage's order
+     * @param system Non-owning pointer; must stay valid until removed
+     */
+    void addSystem(ISystem* system);
+
+    /**
+     * @brief Removes a previously added system
+     * @return true if the system was registered
+     */
+    bool removeSystem(ISystem* system);
+
+    /**
+     * @brief Forces the dependency graphs to be rebuilt (e.g. after a system changes its access)
+     */
+    void invalidate()
+    {
+        m_dirty = true;
+    }
+
+    /**
+     * @brief Runs every system in a stage, respecting declared dependencies
+     * @param stage Stage to execute
+     * @param jobs Job system used for concurrent dispatch (nullptr = serial)
+     * @param run Invoked once per system, possibly from a worker thread
+     *
+     * Must be called from the job system's main thread so main-thread systems can run.
+     */
+    void runStage(UpdateStage stage, JobSystem* jobs, const RunFn& run);
+
+    /**
+     * @brief Systems in registration order
+     */
+    const std::vector<ISystem*>& getSystems() const
+    {
+        return m_systems;
+    }
+
+    /**
+     * @brief Indices (into the stage's order) a system must wait for; exposed for diagnostics/tests
+     * @return Empty if the system is not registered
+     */
+    std::vector<size_t> getDependencies(const ISystem* system);
+
+private:
+    struct Node
+    {
+        ISystem*            system = nullptr;
+        SystemAccess        access;
+        std::vector<size_t> successors;        ///< Nodes that wait for this one
+        size_t              predecessors = 0;  ///< Number of nodes this one waits for
+        std::vector<size_t> dependencies;      ///< Indices of the nodes this one waits for
+    };
+
+    struct StageGraph
+    {
+        std::vector<Node> nodes;             ///< In registration order
+        bool              parallel = false;  ///< At least two nodes can overlap
+    };
+
+    void        rebuild();
+    StageGraph& graphFor(UpdateStage stage);
+
+    std::vector<ISystem*> m_systems;       ///< Registration order
+    StageGraph            m_preFlush;      ///< Graph for UpdateStage::PreFlush
+    StageGraph            m_postFlush;     ///< Graph for UpdateStage::PostFlush
+    bool                  m_dirty = true;  ///< Graphs need rebuilding
+};
+
+}  // namespace Systems
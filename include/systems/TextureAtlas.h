@@ -0,0 +1,147 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Systems
+{
+
+/**
+ * @brief Skyline bottom-left rectangle packer
+ *
+ * Tracks the top edge of everything placed so far as a list of horizontal
+ * segments and puts each new rectangle where its top ends lowest. Works well
+ * for sprite-sized images arriving in arbitrary order, and packing is a walk
+ * over the segments rather than over free rectangles.
+ */
+class SkylinePacker
+{
+public:
+    SkylinePacker(unsigned width, unsigned height);
+
+    /**
+     * @brief Reserves a width x height area
+     * @param x Set to the left edge of the area
+     * @param y Set to the top edge of the area
+     * @return false if the rectangle no longer fits
+     */
+    bool pack(unsigned width, unsigned height, unsigned& x, unsigned& y);
+
+    /**
+     * @brief Fraction of the area covered by packed rectangles
+     */
+    float getOccupancy() const;
+
+private:
+    struct Segment
+    {
+        unsigned x;
+        unsigned y;
+        unsigned width;
+    };
+
+    /**
+     * @brief Lowest y at which a width x height rectangle starting at segment index fits
+     */
+    bool fits(size_t index, unsigned width, unsigned height, unsigned& y) const;
+
+    void addSegment(size_t index, unsigned x, unsigned y, unsigned width);
+
+    unsigned             m_width;
+    unsigned             m_height;
+    uint64_t             m_usedArea = 0;
+    std::vector<Segment> m_skyline;  ///< Left to right, covering the full width
+};
+
+/**
+ * @brief A texture and the pixel rectangle of it an image occupies
+ */
+struct TextureRegion
+{
+    const sf::Texture* texture = nullptr;
+    sf::FloatRect      rect;  ///< Texture coordinates of the image, in pixels
+};
+
+/**
+ * @brief Loads textures by path and packs the small ones into shared pages
+ *
+ * @description
+ * Images no larger than maxPackedSize in either dimension are copied into a
+ * pageSize x pageSize page; larger ones get a texture of their own. Since
+ * sprites and particles drawn from the same page share a texture, they merge
+ * into one RenderFrame batch no matter which image each of them shows.
+ *
+ * Packed images cannot repeat or be sampled outside their rectangle, which the
+ * renderer never does. Regions stay valid until clear().
+ */
+class TextureAtlas
+{
+public:
+    /**
+     * @param pageSize Side of each page in pixels (capped to the GPU's maximum texture size)
+     * @param maxPackedSize Largest image side that is packed instead of kept standalone
+     * @param padding Empty pixels kept between packed images
+     */
+    explicit TextureAtlas(unsigned pageSize = 2048, unsigned maxPackedSize = 256, unsigned padding = 1);
+
+    /**
+     * @brief Finds the region loaded from path, loading the image on first use
+     * @return nullptr if the file could not be loaded (logged once per path)
+     */
+    const TextureRegion* load(const std::string& path);
+
+    /**
+     * @brief Adds an already decoded image under key; a known key keeps its existing region
+     * @return The image's region, or nullptr if a texture could not be created
+     */
+    const TextureRegion* add(const std::string& key, const sf::Image& image);
+
+    /**
+     * @brief The region added under key, or nullptr
+     */
+    const TextureRegion* find(const std::string& key) const;
+
+    size_t getPageCount() const
+    {
+        return m_pages.size();
+    }
+
+    size_t getRegionCount() const
+    {
+        return m_regions.size();
+    }
+
+    /**
+     * @brief Releases every page and standalone texture
+     */
+    void clear();
+
+private:
+    struct Page
+    {
+        std::unique_ptr<sf::Texture> texture;
+        SkylinePacker                packer;
+    };
+
+    /**
+     * @brief Copies image into a page with room, opening a new page if needed
+     */
+    bool pack(const sf::Image& image, TextureRegion& region);
+
+    unsigned m_pageSize;
+    unsigned m_maxPackedSize;
+    unsigned m_padding;
+
+    std::vector<Page>                              m_pages;
+    std::vector<std::unique_ptr<sf::Texture>>      m_standalone;   ///< Textures too large to pack
+    std::unordered_map<std::string, TextureRegion> m_regions;      ///< By path or key
+    std::unordered_set<std::string>                m_failedPaths;  ///< Not retried every frame
+};
+
+}  // namespace Systems
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <AssetHandle.h>
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "JobSystem.h"
+#include "TextureAtlas.h"
+
+namespace Systems
+{
+
+/**
+ * @brief Decodes texture files on job workers and uploads them into an atlas on the render thread
+ *
+ * @description
+ * request() queues the file for decoding on the JobSystem and returns at once.
+ * upload() runs on the thread that builds frames: it hands decoded images to
+ * the atlas (the only step that touches the GPU) until its time budget is
+ * spent, so a burst of new assets is spread over several frames instead of
+ * stalling one. Callers draw with a placeholder until upload() reports the
+ * texture as ready.
+ *
+ * Without a JobSystem, or one without workers, request() decodes synchronously
+ * and the image is still uploaded by the next upload().
+ */
+class TextureStreamer
+{
+public:
+    /**
+     * @param atlas Receives every uploaded texture; must outlive the streamer
+     */
+    explicit TextureStreamer(TextureAtlas& atlas);
+
+    /** @brief Waits for decodes still running on workers */
+    ~TextureStreamer();
+
+    TextureStreamer(const TextureStreamer&)            = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    /**
+     * @brief Starts decoding path unless it is already queued, decoding or waiting for upload
+     * @param handle Handle reported back by upload(), normally AssetHandles::intern(path)
+     * @param jobs Pool to decode on, or nullptr to decode on the calling thread
+     * @return true if a new decode was started
+     */
+    bool request(AssetHandle handle, const std::string& path, JobSystem* jobs);
+
+    /**
+     * @brief Uploads decoded images into the atlas until budgetMs has elapsed
+     * @param onReady Called as onReady(handle, region) for each finished request;
+     *        region is nullptr if the file could not be decoded or uploaded
+     * @return Number of requests finished
+     *
+     * At least one image is uploaded per call, so progress never stalls on a tiny budget.
+     */
+    template <typename Callback>
+    size_t upload(float budgetMs, Callback&& onReady);
+
+    /**
+     * @brief Requests that are decoding or waiting for upload
+     */
+    size_t getPendingCount() const;
+
+    /**
+     * @brief Waits for running decodes and drops everything not yet uploaded
+     */
+    void clear();
+
+private:
+    struct Decoded
+    {
+        AssetHandle                handle = AssetHandles::kInvalid;
+        std::string                path;
+        std::unique_ptr<sf::Image> image;  ///< nullptr if decoding failed
+    };
+
+    /**
+     * @brief Loads path into a new Decoded entry and queues it for upload
+     */
+    void decode(AssetHandle handle, const std::string& path);
+
+    /**
+     * @brief Swaps the images decoded by workers into m_uploading
+     */
+    void takeDecoded();
+
+    /**
+     * @brief Uploads one decoded image, returning its atlas region or nullptr
+     */
+    const TextureRegion* uploadOne(const Decoded& decoded);
+
+    TextureAtlas& m_atlas;
+    JobSystem*    m_decodeJobs = nullptr;  ///< Pool the running decodes were scheduled on
+    JobCounter    m_inFlight;              ///< Decodes scheduled and not yet finished
+
+    mutable std::mutex       m_mutex;      ///< Guards m_decoded and m_requested
+    std::vector<Decoded>     m_decoded;    ///< Finished decodes, filled by workers
+    std::vector<AssetHandle> m_requested;  ///< Handles queued, decoding or awaiting upload
+
+    std::vector<Decoded> m_uploading;  ///< Render-thread copy of the decoded queue
+    size_t               m_uploadPosition = 0;
+};
+
+template <typename Callback>
+size_t TextureStreamer::upload(float budgetMs, Callback&& onReady)
+{
+    if (m_uploadPosition == m_uploading.size())
+    {
+        takeDecoded();
+    }
+
+    const sf::Clock clock;
+    size_t          finished = 0;
+    while (m_uploadPosition < m_uploading.size())
+    {
+        if (finished > 0 && clock.getElapsedTime().asSeconds() * 1000.0f >= budgetMs)
+        {
+            break;
+        }
+
+        Decoded& decoded = m_uploading[m_uploadPosition++];
+        onReady(decoded.handle, uploadOne(decoded));
+        decoded.image.reset();
+        ++finished;
+    }
+    return finished;
+}
+
+}  // namespace Systems
@@ -0,0 +1,49 @@
+#ifndef ASSETHANDLE_H
+#define ASSETHANDLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Small integer standing in for an asset key (a file path or a combination of paths)
+ *
+ * Equal keys always get the same handle, so systems can keep their loaded
+ * resources in arrays indexed by handle instead of maps keyed by string.
+ */
+using AssetHandle = uint32_t;
+
+/**
+ * @brief Process-wide table handing out one AssetHandle per distinct asset key
+ *
+ * @description
+ * Components intern their paths when the path is set; the per-frame draw path
+ * then only indexes by the handle. Interning takes a lock and hashes the key,
+ * so it belongs in setters and loaders, not in per-frame code. Handles are
+ * never reused and stay valid for the life of the process.
+ */
+class AssetHandles
+{
+public:
+    static constexpr AssetHandle kInvalid = 0;  ///< Handle of the empty key
+
+    /**
+     * @brief The handle of key, assigning the next free one on first use
+     * @return kInvalid for an empty key
+     */
+    static AssetHandle intern(const std::string& key);
+
+    /**
+     * @brief The key handle was interned from, or an empty string for kInvalid and unknown handles
+     *
+     * The returned reference stays valid for the life of the process.
+     */
+    static const std::string& keyOf(AssetHandle handle);
+
+    /**
+     * @brief Number of distinct keys interned so far
+     */
+    static size_t count();
+};
+
+#endif  // ASSETHANDLE_H
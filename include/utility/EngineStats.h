@@ -0,0 +1,156 @@
+#ifndef ENGINE_STATS_H
+#define ENGINE_STATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief How a StatCounter behaves between snapshots
+ */
+enum class StatCounterKind
+{
+    Gauge,    ///< Keeps its value until changed (pool sizes, active connections)
+    PerFrame  ///< Reset to 0 after every snapshot (spawns this frame, cache misses this frame)
+};
+
+/**
+ * @brief A named 64-bit counter registered with StatCounters
+ *
+ * Updating is a single relaxed atomic operation, so counters may be bumped from
+ * worker threads and hot loops.
+ */
+class StatCounter
+{
+public:
+    StatCounter(std::string name, StatCounterKind kind) : m_name(std::move(name)), m_kind(kind) {}
+
+    StatCounter(const StatCounter&)            = delete;
+    StatCounter& operator=(const StatCounter&) = delete;
+
+    void add(int64_t amount = 1)
+    {
+        m_value.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    void set(int64_t value)
+    {
+        m_value.store(value, std::memory_order_relaxed);
+    }
+
+    int64_t value() const
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+    const std::string& name() const
+    {
+        return m_name;
+    }
+
+    StatCounterKind kind() const
+    {
+        return m_kind;
+    }
+
+private:
+    friend class StatCounters;
+
+    const std::string     m_name;
+    const StatCounterKind m_kind;
+    std::atomic<int64_t>  m_value{0};
+};
+
+/**
+ * @brief A counter's value as captured by a snapshot
+ */
+struct StatCounterValue
+{
+    std::string name;
+    int64_t     value = 0;
+};
+
+/**
+ * @brief Registry of named counters that custom systems publish through GameEngine::stats()
+ *
+ * @code
+ * // Once, when the system is created
+ * StatCounter& spawned = engine.getStatCounters().counter("Spawner.spawned", StatCounterKind::PerFrame);
+ * // Any frame, any thread
+ * spawned.add();
+ * @endcode
+ *
+ * References returned by counter() stay valid for the registry's lifetime.
+ */
+class StatCounters
+{
+public:
+    /**
+     * @brief Finds or registers the counter called name
+     *
+     * Takes a lock; look counters up once and keep the reference. The kind of an
+     * existing counter is not changed.
+     */
+    StatCounter& counter(const std::string& name, StatCounterKind kind = StatCounterKind::Gauge);
+
+    /**
+     * @brief Copies every counter's value into out, then resets PerFrame counters
+     *
+     * Reuses out's strings, so steady-state snapshots do not allocate.
+     */
+    void snapshot(std::vector<StatCounterValue>& out);
+
+    size_t size() const;
+
+private:
+    mutable std::mutex      m_mutex;
+    std::deque<StatCounter> m_counters;  ///< Deque keeps references stable as counters are added
+};
+
+/**
+ * @brief Live component count of one registered component type
+ */
+struct ComponentTypeCount
+{
+    std::string typeName;
+    size_t      count = 0;
+};
+
+/**
+ * @brief Engine-wide runtime counters, refreshed at the end of every GameEngine::update()
+ *
+ * Render figures describe the most recently rendered frame, i.e. the render()
+ * that followed the previous update().
+ */
+struct EngineStats
+{
+    uint64_t frame       = 0;  ///< update() calls so far
+    size_t   entityCount = 0;  ///< Live entities
+
+    std::vector<ComponentTypeCount> componentCounts;  ///< Live components per component type
+
+    size_t commandBufferSize = 0;  ///< Deferred commands and destroys applied by this update's flush
+
+    size_t renderQueueLength = 0;  ///< Visible renderables and emitters queued for the last frame
+    size_t culledRenderables = 0;  ///< Renderables outside the view in the last frame
+    size_t culledEmitters    = 0;  ///< Particle emitters outside the view in the last frame
+    size_t renderBatches     = 0;  ///< Batches the render queue merged into for the last frame
+    size_t drawCalls         = 0;  ///< Draws the renderer issued for the last frame
+    size_t particleVertices  = 0;  ///< Vertices SParticle built for the last frame
+    size_t liveParticles     = 0;  ///< Particles alive after this update
+
+    size_t physicsBodies = 0;     ///< Box2D bodies
+    size_t physicsShapes = 0;     ///< Box2D shapes
+    float  physicsStepMs = 0.0f;  ///< Duration of the last Box2D step
+
+    size_t activeSoundSlots = 0;  ///< SFX pool slots currently playing
+
+    std::vector<StatCounterValue> counters;  ///< Values of every StatCounters counter
+};
+
+#endif  // ENGINE_STATS_H
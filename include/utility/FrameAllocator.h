@@ -0,0 +1,101 @@
+#ifndef FRAME_ALLOCATOR_H
+#define FRAME_ALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Per-frame bump allocator for transient data, usable through std::pmr containers
+ *
+ * @description
+ * Allocation bumps an atomic offset into one contiguous block, so it is
+ * lock-free and safe from any thread. Deallocation is a no-op; everything is
+ * released at once by reset(), which GameEngine calls at the start of every
+ * update. A frame that outgrows the block falls back to the upstream resource
+ * and the next reset() enlarges the block to the frame's high-water mark, so a
+ * steady-state frame performs no heap allocations.
+ *
+ * @code
+ * std::pmr::vector<Entity> visible(world.frameMemory());
+ * @endcode
+ *
+ * Memory must not be kept past the frame it was allocated in.
+ */
+class FrameAllocator : public std::pmr::memory_resource
+{
+public:
+    /**
+     * @brief Creates the allocator and reserves its first block
+     * @param initialCapacity Bytes reserved up front
+     * @param upstream Resource providing the block and overflow allocations
+     */
+    explicit FrameAllocator(size_t                      initialCapacity = 256 * 1024,
+                            std::pmr::memory_resource* upstream        = std::pmr::new_delete_resource());
+    ~FrameAllocator() override;
+
+    FrameAllocator(const FrameAllocator&)            = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    /**
+     * @brief Releases everything allocated this frame
+     *
+     * Must not run concurrently with allocations or while frame memory is still in use.
+     */
+    void reset();
+
+    /**
+     * @brief Size of the contiguous block in bytes
+     */
+    size_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * @brief Bytes handed out since the last reset(), including alignment padding and overflow
+     */
+    size_t getBytesUsed() const;
+
+    /**
+     * @brief Largest getBytesUsed() observed at any reset()
+     */
+    size_t getHighWaterMark() const
+    {
+        return m_highWaterMark;
+    }
+
+    /**
+     * @brief Allocations served by the upstream resource since the last reset()
+     */
+    size_t getOverflowCount() const;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    struct Overflow
+    {
+        void*  pointer;
+        size_t bytes;
+        size_t alignment;
+    };
+
+    void releaseOverflow();
+
+    std::pmr::memory_resource* m_upstream;            ///< Source of the block and overflow allocations
+    std::byte*                 m_block    = nullptr;  ///< Contiguous bump region
+    size_t                     m_capacity = 0;        ///< Size of m_block
+    std::atomic<size_t>        m_offset{0};           ///< Next free byte in m_block
+    size_t                     m_highWaterMark = 0;   ///< Peak bytes used by a frame
+
+    mutable std::mutex    m_overflowMutex;      ///< Guards the overflow list
+    std::vector<Overflow> m_overflow;           ///< Allocations that did not fit this frame
+    size_t                m_overflowBytes = 0;  ///< Bytes in m_overflow
+};
+
+#endif  // FRAME_ALLOCATOR_H
@@ -0,0 +1,123 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Frame limiter that sleeps until just before each deadline and spins the rest
+ *
+ * @description
+ * OS sleeps overshoot by up to a scheduler tick, which is most of a frame at high
+ * refresh rates. The pacer therefore sleeps only until a spin margin before the
+ * deadline and yields in a loop for the remainder. The margin widens automatically
+ * when the OS is seen to oversleep (coarse timers).
+ *
+ * Deadlines advance by exactly one period so the cadence does not drift. A frame whose
+ * work runs past its deadline counts as missed and restarts the schedule from the
+ * moment it finished instead of rushing the following frames to catch up.
+ *
+ * @code
+ * while (engine.is_running())
+ * {
+ *     engine.update(pacer.waitForNextFrame());
+ *     engine.render();
+ * }
+ * @endcode
+ */
+class FramePacer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t kSmoothingFrames = 8;  ///< Frames averaged into getDeltaTime()
+
+    /**
+     * @param targetFrameRate Frames per second to pace to; 0 disables waiting
+     * @param spinThresholdSeconds Minimum time before a deadline spent spinning rather than sleeping
+     */
+    explicit FramePacer(double targetFrameRate = 0.0, double spinThresholdSeconds = 0.002);
+
+    /**
+     * @brief Changes the target rate; 0 disables waiting. Restarts the deadline schedule.
+     */
+    void setTargetFrameRate(double framesPerSecond);
+
+    double getTargetFrameRate() const
+    {
+        return m_targetFrameRate;
+    }
+
+    /**
+     * @brief Minimum time before a deadline spent spinning rather than sleeping
+     */
+    void setSpinThreshold(double seconds);
+
+    /**
+     * @brief Waits for the current frame's deadline and starts the next frame
+     * @return Smoothed delta time in seconds to simulate the new frame with
+     */
+    float waitForNextFrame();
+
+    /**
+     * @brief Mean of the last kSmoothingFrames clamped frame deltas, in seconds
+     */
+    float getDeltaTime() const
+    {
+        return m_smoothedDelta;
+    }
+
+    /**
+     * @brief Unsmoothed time between the last two frame starts, in seconds
+     */
+    float getRawDeltaTime() const
+    {
+        return m_rawDelta;
+    }
+
+    /**
+     * @brief Frames whose work ran past their deadline
+     */
+    uint64_t getMissedDeadlines() const
+    {
+        return m_missedDeadlines;
+    }
+
+    /**
+     * @brief Frames started through waitForNextFrame()
+     */
+    uint64_t getFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+    /**
+     * @brief Forgets the schedule, delta history and counters; the next frame starts immediately
+     */
+    void reset();
+
+private:
+    void waitUntil(Clock::time_point deadline);
+
+    double          m_targetFrameRate = 0.0;  ///< 0 = unlimited
+    Clock::duration m_period{};               ///< 1 / target rate
+    Clock::duration m_spinThreshold{};        ///< Minimum spin window
+    Clock::duration m_sleepOvershoot{};       ///< Worst observed oversleep, added to the spin window
+
+    bool              m_started = false;  ///< A frame has begun since the last reset
+    Clock::time_point m_frameStart;       ///< Start of the current frame
+    Clock::time_point m_deadline;         ///< When the next frame may start
+
+    std::array<float, kSmoothingFrames> m_history{};        ///< Recent clamped deltas
+    size_t                              m_historySize = 0;  ///< Valid entries in m_history
+    size_t                              m_historyNext = 0;  ///< Slot the next delta overwrites
+
+    float    m_rawDelta        = 0.0f;
+    float    m_smoothedDelta   = 0.0f;
+    uint64_t m_missedDeadlines = 0;
+    uint64_t m_frameCount      = 0;
+};
+
+#endif  // FRAME_PACER_H
@@ -0,0 +1,90 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Severity of a message written through Log
+ */
+enum class LogLevel
+{
+    Debug,
+    Info,
+    Warn,
+    Error
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GAMEENGINE_PRINTF_FORMAT(formatIndex, firstArg) __attribute__((format(printf, formatIndex, firstArg)))
+#else
+#define GAMEENGINE_PRINTF_FORMAT(formatIndex, firstArg)
+#endif
+
+/**
+ * @brief printf-style logging into the engine's logger, usable from headers that cannot depend on spdlog
+ *
+ * Messages go to spdlog's default logger, which GameEngine replaces with its asynchronous
+ * logger, so writing never waits on the console or log file.
+ */
+namespace Log
+{
+void write(LogLevel level, const char* format, ...) GAMEENGINE_PRINTF_FORMAT(2, 3);
+
+/**
+ * @brief Like write(), noting how many messages from the same call site were dropped before this one
+ */
+void writeAfterSuppressed(LogLevel level, uint64_t suppressed, const char* format, ...) GAMEENGINE_PRINTF_FORMAT(3, 4);
+}  // namespace Log
+
+/**
+ * @brief Lets a burst of messages through per time window and counts the rest
+ *
+ * Used by GAMEENGINE_LOG_RATE_LIMITED; one instance per call site. Thread-safe.
+ */
+class LogRateLimiter
+{
+public:
+    /**
+     * @param burst Messages allowed per window
+     * @param windowSeconds Window length
+     */
+    LogRateLimiter(uint32_t burst, double windowSeconds);
+
+    /**
+     * @brief Whether the caller may log now
+     * @param suppressed Set to the messages dropped since the last allowed one when returning true
+     */
+    bool allow(uint64_t& suppressed);
+
+private:
+    const uint32_t        m_burst;             ///< Messages allowed per window
+    const uint64_t        m_windowNs;          ///< Window length
+    std::atomic<uint64_t> m_windowStart{0};    ///< Start of the current window (steady clock ns)
+    std::atomic<uint32_t> m_countInWindow{0};  ///< Messages seen in the current window
+    std::atomic<uint64_t> m_suppressed{0};     ///< Messages dropped since the last allowed one
+};
+
+/**
+ * @brief Logs at most a few messages per second from this call site
+ *
+ * For hot paths (per entity, per frame). Dropped messages are counted and reported with
+ * the next message that gets through, so a misconfigured entity yields a handful of lines
+ * per second instead of one per frame.
+ *
+ * @code
+ * GAMEENGINE_LOG_RATE_LIMITED(LogLevel::Warn, "SRenderer: entity %u has no CTransform", entity.index);
+ * @endcode
+ */
+#define GAMEENGINE_LOG_RATE_LIMITED(level, ...)                                         \
+    do                                                                                  \
+    {                                                                                   \
+        static ::LogRateLimiter gameEngineLogLimiter(5, 1.0);                           \
+        uint64_t                gameEngineLogSuppressed = 0;                            \
+        if (gameEngineLogLimiter.allow(gameEngineLogSuppressed))                        \
+        {                                                                               \
+            ::Log::writeAfterSuppressed((level), gameEngineLogSuppressed, __VA_ARGS__); \
+        }                                                                               \
+    } while (0)
+
+#endif  // LOG_H
@@ -0,0 +1,192 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One timed scope as recorded by the Profiler
+ */
+struct ProfileSample
+{
+    const char* name       = nullptr;  ///< Scope name (static storage)
+    uint32_t    threadId   = 0;        ///< Small per-thread id assigned on first record
+    uint64_t    startNs    = 0;        ///< Start time since the profiler epoch
+    uint64_t    durationNs = 0;        ///< Scope duration
+};
+
+/**
+ * @brief Aggregate timings of every sample sharing a scope name
+ */
+struct ProfileScopeStats
+{
+    std::string name;
+    size_t      count   = 0;
+    double      totalMs = 0.0;
+    double      meanMs  = 0.0;
+    double      p50Ms   = 0.0;
+    double      p95Ms   = 0.0;
+    double      p99Ms   = 0.0;
+    double      maxMs   = 0.0;
+};
+
+/**
+ * @brief Process-wide frame profiler with per-thread sample rings
+ *
+ * @description
+ * Scopes are recorded with GAMEENGINE_PROFILE_SCOPE("Name"). Each recording
+ * thread owns a fixed-size ring, so recording never takes a lock or allocates
+ * after the thread's first sample; once a ring is full the oldest samples are
+ * overwritten. collect(), summary() and writeChromeTrace() may run while other
+ * threads keep recording.
+ *
+ * Recording is off by default. While disabled a scope costs one relaxed atomic
+ * load; building with GAMEENGINE_PROFILER_DISABLED compiles scopes out entirely.
+ *
+ * Scope names are stored by pointer and must have static storage duration
+ * (string literals, typeid names).
+ */
+class Profiler
+{
+public:
+    static constexpr size_t kSamplesPerThread = 16384;  ///< Ring capacity of each recording thread
+
+    /**
+     * @brief The process-wide profiler
+     */
+    static Profiler& instance();
+
+    /**
+     * @brief Whether scopes are currently being recorded
+     */
+    static bool isEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Starts or stops recording; samples already recorded are kept
+     */
+    static void setEnabled(bool enabled)
+    {
+        s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Nanoseconds since the profiler epoch (the first call in the process)
+     */
+    static uint64_t now();
+
+    /**
+     * @brief Records a finished scope for the calling thread
+     * @param name Scope name with static storage duration
+     * @param startNs Start time from now()
+     * @param endNs End time from now()
+     */
+    void record(const char* name, uint64_t startNs, uint64_t endNs);
+
+    /**
+     * @brief Copies every retained sample from all threads, ordered by start time
+     */
+    std::vector<ProfileSample> collect() const;
+
+    /**
+     * @brief Discards all samples recorded so far
+     */
+    void clear();
+
+    /**
+     * @brief Per-scope count, mean and p50/p95/p99/max, sorted by total time (highest first)
+     */
+    std::vector<ProfileScopeStats> computeStats() const;
+
+    /**
+     * @brief Human-readable table of computeStats()
+     */
+    std::string summary() const;
+
+    /**
+     * @brief Retained samples in Chrome trace event format (chrome://tracing, Perfetto)
+     */
+    std::string chromeTrace() const;
+
+    /**
+     * @brief Writes chromeTrace() to a file
+     * @return false if the file could not be written
+     */
+    bool writeChromeTrace(const std::string& path) const;
+
+private:
+    struct Slot
+    {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t>    startNs{0};
+        std::atomic<uint64_t>    durationNs{0};
+    };
+
+    /**
+     * @brief Single-producer ring owned by one recording thread
+     */
+    struct ThreadBuffer
+    {
+        explicit ThreadBuffer(uint32_t id) : threadId(id), slots(new Slot[kSamplesPerThread]) {}
+
+        const uint32_t          threadId;    ///< Id reported in samples
+        std::unique_ptr<Slot[]> slots;       ///< kSamplesPerThread entries
+        std::atomic<uint64_t>   head{0};     ///< Total samples ever written
+        std::atomic<uint64_t>   writing{0};  ///< One past the index currently being written
+        std::atomic<uint64_t>   floor{0};    ///< Samples below this index were cleared
+    };
+
+    Profiler() = default;
+
+    ThreadBuffer& bufferForThisThread();
+
+    inline static std::atomic<bool> s_enabled{false};  ///< Global recording switch
+
+    mutable std::mutex                         m_buffersMutex;  ///< Guards m_buffers (registration and reads)
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;       ///< One per thread that ever recorded
+};
+
+/**
+ * @brief RAII timer recording its lifetime as a profiler scope
+ */
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name)
+        : m_name(Profiler::isEnabled() ? name : nullptr), m_startNs(m_name ? Profiler::now() : 0)
+    {
+    }
+
+    ~ProfileScope()
+    {
+        if (m_name)
+        {
+            Profiler::instance().record(m_name, m_startNs, Profiler::now());
+        }
+    }
+
+    ProfileScope(const ProfileScope&)            = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name;     ///< nullptr when recording was off at construction
+    uint64_t    m_startNs;  ///< Start time from Profiler::now()
+};
+
+#define GAMEENGINE_PROFILE_CONCAT_INNER(a, b) a##b
+#define GAMEENGINE_PROFILE_CONCAT(a, b) GAMEENGINE_PROFILE_CONCAT_INNER(a, b)
+
+#ifndef GAMEENGINE_PROFILER_DISABLED
+#define GAMEENGINE_PROFILE_SCOPE(name) ::ProfileScope GAMEENGINE_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define GAMEENGINE_PROFILE_SCOPE(name) ((void)0)
+#endif
+
+#endif  // PROFILER_H
@@ -3,31 +3,46 @@
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <stdexcept>
 #include <typeindex>
 
 // Include all component types for registry registration
 #include <Components.h>
+#include <Profiler.h>
 #include <SystemLocator.h>
 
-GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity, uint8_t subStepCount, float timeStep, float pixelsPerMeter)
-    : m_renderer(std::make_unique<Systems::SRenderer>()),
+GameEngine::GameEngine(const Systems::WindowConfig& windowConfig,
+                       Vec2                         gravity,
+                       uint8_t                      subStepCount,
+                       float                        timeStep,
+                       float                        pixelsPerMeter,
+                       size_t                       jobWorkerCount)
+    : m_jobs(std::make_unique<Systems::JobSystem>(jobWorkerCount)),
+      m_renderer(std::make_unique<Systems::SRenderer>()),
       m_input(std::make_unique<Systems::SInput>()),
       m_script(std::make_unique<Systems::SScript>()),
       m_physics(std::make_unique<Systems::S2DPhysics>()),
       m_particle(std::make_unique<Systems::SParticle>()),
-      m_audio(std::make_unique<Systems::SAudio>()),
+      m_audio(std::make_unique<Systems::SAudio>(AudioConstants::DEFAULT_SFX_POOL_SIZE,
+                                                windowConfig.headless ? AudioBackend::Null : AudioBackend::Device)),
       m_subStepCount(subStepCount),
-      m_timeStep(1.0f / 60.0f),
-      m_gravity(gravity)
+      m_timeStep(timeStep > 0.0f ? timeStep : 1.0f / 60.0f),
+      m_headless(windowConfig.headless),
+      m_gravity(gravity),
+      m_framePacer(windowConfig.headless ? 0.0 : static_cast<double>(windowConfig.frameLimit))
 {
     Systems::SystemLocator::provideRenderer(m_renderer.get());
     Systems::SystemLocator::provideInput(m_input.get());
     Systems::SystemLocator::providePhysics(m_physics.get());
     Systems::SystemLocator::provideParticle(m_particle.get());
     Systems::SystemLocator::provideAudio(m_audio.get());
+    Systems::SystemLocator::provideJobs(m_jobs.get());
+
+    m_world.setFrameMemory(&m_frameAllocator);
 
     // Allow physics system to resolve component data without auxiliary maps
     m_physics->bindWorld(&m_world);
@@ -60,9 +75,23 @@ GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity,
                 std::cerr << "GameEngine: failed to create log file (game_engine.log): " << e.what() << "\n";
             }
 
-            auto logger = std::make_shared<spdlog::logger>("GameEngine", sinks.begin(), sinks.end());
+            // Formatting and sink I/O run on spdlog's worker thread. When the queue is full the
+            // oldest message is dropped rather than stalling the frame that is logging.
+            if (!spdlog::thread_pool())
+            {
+                spdlog::init_thread_pool(8192, 1);
+            }
+            auto logger = std::make_shared<spdlog::async_logger>("GameEngine",
+                                                                 sinks.begin(),
+                                                                 sinks.end(),
+                                                                 spdlog::thread_pool(),
+                                                                 spdlog::async_overflow_policy::overrun_oldest);
             logger->set_level(spdlog::level::info);
+            logger->flush_on(spdlog::level::err);
             spdlog::register_logger(logger);
+
+            // Systems log through spdlog's free functions and Log::write, so route those here too
+            spdlog::set_default_logger(logger);
         }
         catch (const std::exception& e)
         {
@@ -73,16 +102,24 @@ GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity,
     if (auto logger = spdlog::get("GameEngine"))
     {
         logger->info("GameEngine initialized");
-        logger->info("Window size: {}x{}", windowConfig.width, windowConfig.height);
+        if (m_headless)
+        {
+            logger->info("Running headless (no window, rendering or audio device)");
+        }
+        else
+        {
+            logger->info("Window size: {}x{}", windowConfig.width, windowConfig.height);
+        }
         logger->info("SubSteps: {}, TimeStep: {}", (int)subStepCount, m_timeStep);
+        logger->info("Job system workers: {}", m_jobs->getWorkerCount());
         if (timeStep != m_timeStep)
         {
-            logger->warn("Ignoring requested timeStep {} and enforcing fixed 60Hz ({}).", timeStep, m_timeStep);
+            logger->warn("Ignoring non-positive timeStep {} and using 60Hz ({}).", timeStep, m_timeStep);
         }
     }
 
-    // Initialize renderer
-    if (!m_renderer->initialize(windowConfig))
+    // Initialize renderer (headless engines never create a window, so there is nothing to fail)
+    if (!m_headless && !m_renderer->initialize(windowConfig))
     {
         if (auto logger = spdlog::get("GameEngine"))
         {
@@ -112,6 +149,7 @@ GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity,
         {
             if (ev.type == InputEventType::WindowClosed)
             {
+                waitForRenderedFrame();
                 auto* window = m_renderer->getWindow();
                 if (window)
                 {
@@ -128,9 +166,16 @@ GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity,
     // Note: Users can re-initialize with different scale if needed
     m_particle->initialize(m_renderer->getWindow(), pixelsPerMeter);
 
-    // Maintain ordered list for per-frame updates (input -> scripts -> physics -> particle -> audio)
-    // Audio is marked as PostFlush via ISystem::stage().
-    m_systemOrder = {m_input.get(), m_script.get(), m_physics.get(), m_particle.get(), m_audio.get()};
+    // Registration order is the update order for conflicting systems (input -> scripts -> physics -> particle -> audio).
+    // Audio is marked as PostFlush via ISystem::stage(); user systems added later run after the built-ins.
+    for (Systems::ISystem* system : {static_cast<Systems::ISystem*>(m_input.get()),
+                                     static_cast<Systems::ISystem*>(m_script.get()),
+                                     static_cast<Systems::ISystem*>(m_physics.get()),
+                                     static_cast<Systems::ISystem*>(m_particle.get()),
+                                     static_cast<Systems::ISystem*>(m_audio.get())})
+    {
+        m_scheduler.addSystem(system);
+    }
 
     if (auto logger = spdlog::get("GameEngine"))
     {
@@ -140,6 +185,9 @@ GameEngine::GameEngine(const Systems::WindowConfig& windowConfig, Vec2 gravity,
 
 GameEngine::~GameEngine()
 {
+    // The render job draws through the renderer, so it must finish before anything shuts down
+    waitForRenderedFrame();
+
     // Shutdown input manager
     if (m_input)
     {
@@ -165,6 +213,7 @@ GameEngine::~GameEngine()
     if (auto logger = spdlog::get("GameEngine"))
     {
         logger->info("GameEngine shutting down");
+        logger->flush();
     }
     // Note: Don't drop the logger or shutdown thread pool here since the logger
     // may be reused if another GameEngine instance is created
@@ -177,54 +226,268 @@ void GameEngine::readInputs()
 
 void GameEngine::update(float deltaTime)
 {
-    auto runStage = [this, deltaTime](Systems::UpdateStage stage)
+    GAMEENGINE_PROFILE_SCOPE("GameEngine::update");
+
+    // Run work that background jobs handed back to the main thread (e.g. GPU uploads)
+    m_jobs->runMainThreadJobs();
+
+    // Every job of the previous frame has finished, so its transient memory can be reused
+    m_frameAllocator.reset();
+
+    // Create accumulators up front so worker threads only ever look them up
+    size_t throttledIndex = 0;
+    for (Systems::ISystem* system : m_scheduler.getSystems())
     {
-        for (auto* system : m_systemOrder)
+        if (system->usesFixedTimestep())
         {
-            if (!system || system->stage() != stage)
+            m_accumulators.try_emplace(system, 0.0f);
+        }
+        else if (system->tickInterval() > 0.0f)
+        {
+            // Stagger the first tick so systems sharing an interval do not all update in the same frame;
+            // the delay only postpones the tick, the time passed on is still the time that really elapsed
+            const float phase = std::fmod(static_cast<float>(throttledIndex++) * 0.618034f, 1.0f);
+            m_accumulators.try_emplace(system, 0.0f);
+            m_tickCountdowns.try_emplace(system, (1.0f + phase) * system->tickInterval());
+        }
+    }
+
+    // May run on a worker thread for systems the scheduler can overlap
+    auto runSystem = [this, deltaTime](Systems::ISystem& system)
+    {
+        GAMEENGINE_PROFILE_SCOPE(system.debugName());
+
+        if (system.usesFixedTimestep())
+        {
+            const float step        = fixedStepFor(system);
+            float&      accumulator = m_accumulators.at(&system);
+
+            accumulator += deltaTime;
+            const float maxAccumulator = step * 10.0f;  // Cap to prevent spiral of death
+            if (accumulator > maxAccumulator)
             {
-                continue;
+                accumulator = maxAccumulator;
             }
 
-            if (system->usesFixedTimestep())
+            while (accumulator >= step)
             {
-                m_accumulator += deltaTime;
-                const float maxAccumulator = m_timeStep * 10.0f;  // Cap to prevent spiral of death
-                if (m_accumulator > maxAccumulator)
-                {
-                    m_accumulator = maxAccumulator;
-                }
+                system.fixedUpdate(step, m_world);
+                accumulator -= step;
+            }
+            return;
+        }
 
-                while (m_accumulator >= m_timeStep)
-                {
-                    system->fixedUpdate(m_timeStep, m_world);
-                    m_accumulator -= m_timeStep;
-                }
-                continue;
+        const float interval = system.tickInterval();
+        if (interval > 0.0f)
+        {
+            float& elapsed   = m_accumulators.at(&system);
+            float& countdown = m_tickCountdowns.at(&system);
+            elapsed += deltaTime;
+            countdown -= deltaTime;
+            if (countdown > 0.0f)
+            {
+                return;
             }
 
-            system->update(deltaTime, m_world);
+            system.update(elapsed, m_world);
+            elapsed   = 0.0f;
+            countdown = interval;
+            return;
         }
+
+        system.update(deltaTime, m_world);
     };
 
-    runStage(Systems::UpdateStage::PreFlush);
+    m_scheduler.runStage(Systems::UpdateStage::PreFlush, m_jobs.get(), runSystem);
 
     // Apply deferred structural commands after pre-flush systems have finished updating to avoid iterator invalidation
-    m_world.flushCommandBuffer();
+    {
+        GAMEENGINE_PROFILE_SCOPE("World::flushCommandBuffer");
+        m_stats.commandBufferSize = m_world.pendingCommandCount() + m_world.pendingDestroyCount();
+        m_world.flushCommandBuffer();
+    }
+
+    m_scheduler.runStage(Systems::UpdateStage::PostFlush, m_jobs.get(), runSystem);
 
-    runStage(Systems::UpdateStage::PostFlush);
+    // Physics drives CTransform, so its leftover time positions rendering between its last two steps
+    auto physicsAccumulator = m_accumulators.find(m_physics.get());
+    m_interpolationAlpha    = physicsAccumulator != m_accumulators.end()
+                                  ? std::min(1.0f, physicsAccumulator->second / fixedStepFor(*m_physics))
+                                  : 1.0f;
+
+    updateStats();
+}
+
+void GameEngine::updateStats()
+{
+    GAMEENGINE_PROFILE_SCOPE("GameEngine::updateStats");
+
+    ++m_stats.frame;
+    m_stats.entityCount = m_world.getEntities().size();
+
+    // Overwrite the previous frame's entries in place so their strings keep their capacity
+    size_t typeCount = 0;
+    m_world.eachComponentCount(
+        [this, &typeCount](const char* typeName, size_t count)
+        {
+            if (typeCount == m_stats.componentCounts.size())
+            {
+                m_stats.componentCounts.emplace_back();
+            }
+            m_stats.componentCounts[typeCount].typeName = typeName;
+            m_stats.componentCounts[typeCount].count    = count;
+            ++typeCount;
+        });
+    m_stats.componentCounts.resize(typeCount);
+
+    const Systems::RenderStats render = m_renderer->getStats();
+    m_stats.renderQueueLength         = render.queueLength;
+    m_stats.culledRenderables         = render.culledRenderables;
+    m_stats.culledEmitters            = render.culledEmitters;
+    m_stats.renderBatches             = render.batches;
+    m_stats.drawCalls                 = render.drawCalls;
+    m_stats.particleVertices          = render.particleVertices;
+    m_stats.liveParticles             = m_particle->getLiveParticleCount();
+
+    m_stats.physicsBodies = m_physics->getBodyCount();
+    m_stats.physicsShapes = m_physics->getShapeCount();
+    m_stats.physicsStepMs = m_physics->getLastStepMs();
+
+    m_stats.activeSoundSlots = m_audio->getActiveSlotCount();
+
+    m_statCounters.snapshot(m_stats.counters);
+}
+
+float GameEngine::fixedStepFor(const Systems::ISystem& system) const
+{
+    const float step = system.fixedTimeStep();
+    return step > 0.0f ? step : m_timeStep;
+}
+
+bool GameEngine::removeSystem(Systems::ISystem& system)
+{
+    if (!m_scheduler.removeSystem(&system))
+    {
+        return false;
+    }
+
+    auto owned = std::find_if(m_userSystems.begin(),
+                              m_userSystems.end(),
+                              [&system](const std::unique_ptr<Systems::ISystem>& candidate)
+                              { return candidate.get() == &system; });
+    m_accumulators.erase(&system);
+    m_tickCountdowns.erase(&system);
+    if (owned != m_userSystems.end())
+    {
+        m_userSystems.erase(owned);
+    }
+    return true;
+}
+
+void GameEngine::step(size_t steps)
+{
+    for (size_t i = 0; i < steps && m_gameRunning; ++i)
+    {
+        update(m_timeStep);
+    }
+}
+
+size_t GameEngine::replayInput(const Systems::InputRecording& recording, bool useRecordedDeltaTimes)
+{
+    const std::vector<Systems::RecordedInputFrame>& frames = recording.getFrames();
+
+    m_input->startReplay(recording);
+
+    size_t replayed = 0;
+    while (replayed < frames.size() && m_input->isReplaying() && m_gameRunning)
+    {
+        update(useRecordedDeltaTimes ? frames[replayed].deltaTime : m_timeStep);
+        ++replayed;
+    }
+
+    m_input->stopReplay();
+    return replayed;
 }
 
 void GameEngine::render()
 {
-    if (!m_renderer)
+    if (!m_renderer || m_headless)
+    {
+        return;
+    }
+
+    GAMEENGINE_PROFILE_SCOPE("GameEngine::render");
+
+    // frameLimit keeps capping loops written before the pacer existed, which never wait on it themselves
+    if (m_framePacer.getTargetFrameRate() > 0.0 && m_framePacer.getFrameCount() == m_pacedFrames)
+    {
+        if (!m_warnedUnpacedLoop)
+        {
+            m_warnedUnpacedLoop = true;
+            if (auto logger = spdlog::get("GameEngine"))
+            {
+                logger->warn("frameLimit is set but getFramePacer().waitForNextFrame() is never called; "
+                             "render() paces the loop instead");
+            }
+        }
+        m_framePacer.waitForNextFrame();
+    }
+    m_pacedFrames = m_framePacer.getFrameCount();
+
+    if (!m_pipelinedRendering || m_jobs->getWorkerCount() == 0)
+    {
+        m_renderer->clear(Color::Black);
+        m_renderer->render(m_world, m_interpolationAlpha);
+        m_renderer->display();
+        return;
+    }
+
+    sf::RenderWindow* window = m_renderer->getWindow();
+    if (!window || !window->isOpen())
     {
         return;
     }
 
-    m_renderer->clear(Color::Black);
-    m_renderer->render(m_world);
-    m_renderer->display();
+    // Record this frame while the previous one may still be drawing from the other buffer
+    Systems::RenderFrame& frame = m_renderFrames[m_renderFrameIndex];
+    m_renderer->buildFrame(m_world, m_interpolationAlpha, frame);
+
+    waitForRenderedFrame();
+    m_renderFrameIndex = 1 - m_renderFrameIndex;
+
+    // Textures and shaders queued while recording touch GL state the render job uses, so they go in between jobs
+    m_renderer->uploadPendingAssets();
+
+    // A GL context can only be current on one thread; release it for whichever worker takes the job
+    window->setActive(false);
+    m_jobs->schedule(
+        [this, window, &frame]()
+        {
+            window->setActive(true);
+            m_renderer->clear(Color::Black);
+            m_renderer->submitFrame(frame);
+            m_renderer->display();
+            window->setActive(false);
+        },
+        &m_renderJob);
+}
+
+void GameEngine::setPipelinedRendering(bool enabled)
+{
+    if (!enabled)
+    {
+        // Later synchronous draws reclaim the GL context on the main thread
+        waitForRenderedFrame();
+    }
+    m_pipelinedRendering = enabled;
+}
+
+void GameEngine::waitForRenderedFrame()
+{
+    if (m_jobs)
+    {
+        m_jobs->wait(m_renderJob);
+    }
 }
 
 bool GameEngine::is_running() const
@@ -256,6 +519,11 @@ Systems::SParticle& GameEngine::getParticleSystem()
     return *m_particle;
 }
 
+Systems::JobSystem& GameEngine::getJobSystem()
+{
+    return *m_jobs;
+}
+
 void GameEngine::registerComponentTypes()
 {
     // Register stable component names for diagnostics and tooling
@@ -0,0 +1,93 @@
+#include "GeometryTemplates.h"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace Systems
+{
+
+namespace
+{
+constexpr size_t kLodCount = sizeof(GeometryTemplates::kCircleLods) / sizeof(GeometryTemplates::kCircleLods[0]);
+
+// Largest screen radius each level keeps within half a pixel of a true circle: r * (1 - cos(pi / n)) <= 0.5
+constexpr float kLodMaxRadius[kLodCount - 1] = {6.5f, 26.0f, 104.0f};
+
+struct CircleTable
+{
+    std::array<std::vector<sf::Vector2f>, kLodCount> points;
+
+    CircleTable()
+    {
+        const double twoPi = 6.283185307179586;
+        for (size_t lod = 0; lod < kLodCount; ++lod)
+        {
+            const size_t segments = GeometryTemplates::kCircleLods[lod];
+            points[lod].reserve(segments);
+            for (size_t i = 0; i < segments; ++i)
+            {
+                // Same layout as sf::CircleShape: the first point is at the top
+                const double angle = static_cast<double>(i) * twoPi / static_cast<double>(segments) - twoPi / 4.0;
+                points[lod].emplace_back(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+            }
+        }
+    }
+};
+
+const CircleTable& circleTable()
+{
+    static const CircleTable table;
+    return table;
+}
+}  // namespace
+
+size_t GeometryTemplates::circleSegments(float screenRadius)
+{
+    for (size_t lod = 0; lod + 1 < kLodCount; ++lod)
+    {
+        if (screenRadius <= kLodMaxRadius[lod])
+        {
+            return kCircleLods[lod];
+        }
+    }
+    return kCircleLods[kLodCount - 1];
+}
+
+const sf::Vector2f* GeometryTemplates::unitCircle(size_t segments)
+{
+    const CircleTable& table = circleTable();
+    for (size_t lod = 0; lod < kLodCount; ++lod)
+    {
+        if (kCircleLods[lod] == segments)
+        {
+            return table.points[lod].data();
+        }
+    }
+    return nullptr;
+}
+
+void GeometryTemplates::writeThickLine(sf::Vertex*  out,
+                                       sf::Vector2f start,
+                                       sf::Vector2f end,
+                                       float        thickness,
+                                       sf::Color    color)
+{
+    const sf::Vector2f direction = end - start;
+    const float        length    = std::hypot(direction.x, direction.y);
+    const sf::Vector2f offset    = length > 0.0f
+                                       ? sf::Vector2f(-direction.y, direction.x) * (thickness / 2.0f / length)
+                                       : sf::Vector2f(0.0f, 0.0f);
+
+    const sf::Vertex corners[4] = {sf::Vertex(start + offset, color),
+                                   sf::Vertex(end + offset, color),
+                                   sf::Vertex(end - offset, color),
+                                   sf::Vertex(start - offset, color)};
+    const int        order[6]   = {0, 1, 2, 0, 2, 3};
+    for (int i = 0; i < 6; ++i)
+    {
+        out[i] = corners[order[i]];
+    }
+}
+
+}  // namespace Systems
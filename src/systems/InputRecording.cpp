@@ -0,0 +1,451 @@
+#include "InputRecording.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Systems
+{
+
+namespace
+{
+constexpr uint8_t  kMagic[4] = {'G', 'E', 'I', 'R'};
+constexpr uint16_t kVersion  = 1;
+
+/**
+ * @brief Event tags in the file; independent of sf::Event::EventType so files survive SFML upgrades
+ */
+enum class RecordedEventType : uint8_t
+{
+    Closed = 1,
+    Resized,
+    TextEntered,
+    KeyPressed,
+    KeyReleased,
+    MouseWheelScrolled,
+    MouseButtonPressed,
+    MouseButtonReleased,
+    MouseMoved
+};
+
+enum KeyModifierBits : uint8_t
+{
+    kAlt     = 1 << 0,
+    kControl = 1 << 1,
+    kShift   = 1 << 2,
+    kSystem  = 1 << 3
+};
+
+bool toRecordedType(sf::Event::EventType type, RecordedEventType& out)
+{
+    switch (type)
+    {
+        case sf::Event::Closed:
+            out = RecordedEventType::Closed;
+            return true;
+        case sf::Event::Resized:
+            out = RecordedEventType::Resized;
+            return true;
+        case sf::Event::TextEntered:
+            out = RecordedEventType::TextEntered;
+            return true;
+        case sf::Event::KeyPressed:
+            out = RecordedEventType::KeyPressed;
+            return true;
+        case sf::Event::KeyReleased:
+            out = RecordedEventType::KeyReleased;
+            return true;
+        case sf::Event::MouseWheelScrolled:
+            out = RecordedEventType::MouseWheelScrolled;
+            return true;
+        case sf::Event::MouseButtonPressed:
+            out = RecordedEventType::MouseButtonPressed;
+            return true;
+        case sf::Event::MouseButtonReleased:
+            out = RecordedEventType::MouseButtonReleased;
+            return true;
+        case sf::Event::MouseMoved:
+            out = RecordedEventType::MouseMoved;
+            return true;
+        default:
+            return false;
+    }
+}
+
+class ByteWriter
+{
+public:
+    explicit ByteWriter(std::vector<uint8_t>& out) : m_out(out) {}
+
+    void u8(uint8_t value)
+    {
+        m_out.push_back(value);
+    }
+
+    void u16(uint16_t value)
+    {
+        u8(static_cast<uint8_t>(value));
+        u8(static_cast<uint8_t>(value >> 8));
+    }
+
+    void u32(uint32_t value)
+    {
+        u16(static_cast<uint16_t>(value));
+        u16(static_cast<uint16_t>(value >> 16));
+    }
+
+    void i32(int32_t value)
+    {
+        u32(static_cast<uint32_t>(value));
+    }
+
+    void f32(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        u32(bits);
+    }
+
+private:
+    std::vector<uint8_t>& m_out;
+};
+
+class ByteReader
+{
+public:
+    ByteReader(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+    bool u8(uint8_t& value)
+    {
+        if (m_offset >= m_size)
+        {
+            return false;
+        }
+        value = m_data[m_offset++];
+        return true;
+    }
+
+    bool u16(uint16_t& value)
+    {
+        uint8_t low, high;
+        if (!u8(low) || !u8(high))
+        {
+            return false;
+        }
+        value = static_cast<uint16_t>(low | (high << 8));
+        return true;
+    }
+
+    bool u32(uint32_t& value)
+    {
+        uint16_t low, high;
+        if (!u16(low) || !u16(high))
+        {
+            return false;
+        }
+        value = static_cast<uint32_t>(low) | (static_cast<uint32_t>(high) << 16);
+        return true;
+    }
+
+    bool i32(int32_t& value)
+    {
+        uint32_t bits;
+        if (!u32(bits))
+        {
+            return false;
+        }
+        value = static_cast<int32_t>(bits);
+        return true;
+    }
+
+    bool f32(float& value)
+    {
+        uint32_t bits;
+        if (!u32(bits))
+        {
+            return false;
+        }
+        std::memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+
+    size_t remaining() const
+    {
+        return m_size - m_offset;
+    }
+
+private:
+    const uint8_t* m_data;
+    size_t         m_size;
+    size_t         m_offset = 0;
+};
+
+void writeEvent(ByteWriter& writer, RecordedEventType type, const sf::Event& event)
+{
+    writer.u8(static_cast<uint8_t>(type));
+    switch (type)
+    {
+        case RecordedEventType::Closed:
+            break;
+        case RecordedEventType::Resized:
+            writer.u32(event.size.width);
+            writer.u32(event.size.height);
+            break;
+        case RecordedEventType::TextEntered:
+            writer.u32(event.text.unicode);
+            break;
+        case RecordedEventType::KeyPressed:
+        case RecordedEventType::KeyReleased:
+            writer.u16(static_cast<uint16_t>(static_cast<int16_t>(event.key.code)));
+            writer.u8(static_cast<uint8_t>((event.key.alt ? kAlt : 0) | (event.key.control ? kControl : 0)
+                                           | (event.key.shift ? kShift : 0) | (event.key.system ? kSystem : 0)));
+            break;
+        case RecordedEventType::MouseWheelScrolled:
+            writer.u8(static_cast<uint8_t>(event.mouseWheelScroll.wheel));
+            writer.f32(event.mouseWheelScroll.delta);
+            writer.i32(event.mouseWheelScroll.x);
+            writer.i32(event.mouseWheelScroll.y);
+            break;
+        case RecordedEventType::MouseButtonPressed:
+        case RecordedEventType::MouseButtonReleased:
+            writer.u8(static_cast<uint8_t>(event.mouseButton.button));
+            writer.i32(event.mouseButton.x);
+            writer.i32(event.mouseButton.y);
+            break;
+        case RecordedEventType::MouseMoved:
+            writer.i32(event.mouseMove.x);
+            writer.i32(event.mouseMove.y);
+            break;
+    }
+}
+
+bool readEvent(ByteReader& reader, sf::Event& event)
+{
+    uint8_t tag;
+    if (!reader.u8(tag))
+    {
+        return false;
+    }
+
+    event = sf::Event{};
+    switch (static_cast<RecordedEventType>(tag))
+    {
+        case RecordedEventType::Closed:
+            event.type = sf::Event::Closed;
+            return true;
+        case RecordedEventType::Resized:
+            event.type = sf::Event::Resized;
+            return reader.u32(event.size.width) && reader.u32(event.size.height);
+        case RecordedEventType::TextEntered:
+        {
+            uint32_t unicode;
+            event.type         = sf::Event::TextEntered;
+            const bool ok      = reader.u32(unicode);
+            event.text.unicode = unicode;
+            return ok;
+        }
+        case RecordedEventType::KeyPressed:
+        case RecordedEventType::KeyReleased:
+        {
+            uint16_t code;
+            uint8_t  modifiers;
+            if (!reader.u16(code) || !reader.u8(modifiers))
+            {
+                return false;
+            }
+            event.type        = static_cast<RecordedEventType>(tag) == RecordedEventType::KeyPressed
+                                    ? sf::Event::KeyPressed
+                                    : sf::Event::KeyReleased;
+            event.key.code    = static_cast<sf::Keyboard::Key>(static_cast<int16_t>(code));
+            event.key.alt     = (modifiers & kAlt) != 0;
+            event.key.control = (modifiers & kControl) != 0;
+            event.key.shift   = (modifiers & kShift) != 0;
+            event.key.system  = (modifiers & kSystem) != 0;
+            return true;
+        }
+        case RecordedEventType::MouseWheelScrolled:
+        {
+            uint8_t wheel;
+            if (!reader.u8(wheel))
+            {
+                return false;
+            }
+            event.type                   = sf::Event::MouseWheelScrolled;
+            event.mouseWheelScroll.wheel = static_cast<sf::Mouse::Wheel>(wheel);
+            return reader.f32(event.mouseWheelScroll.delta) && reader.i32(event.mouseWheelScroll.x)
+                   && reader.i32(event.mouseWheelScroll.y);
+        }
+        case RecordedEventType::MouseButtonPressed:
+        case RecordedEventType::MouseButtonReleased:
+        {
+            uint8_t button;
+            if (!reader.u8(button))
+            {
+                return false;
+            }
+            event.type               = static_cast<RecordedEventType>(tag) == RecordedEventType::MouseButtonPressed
+                                           ? sf::Event::MouseButtonPressed
+                                           : sf::Event::MouseButtonReleased;
+            event.mouseButton.button = static_cast<sf::Mouse::Button>(button);
+            return reader.i32(event.mouseButton.x) && reader.i32(event.mouseButton.y);
+        }
+        case RecordedEventType::MouseMoved:
+            event.type = sf::Event::MouseMoved;
+            return reader.i32(event.mouseMove.x) && reader.i32(event.mouseMove.y);
+    }
+    return false;
+}
+}  // namespace
+
+void InputRecording::addFrame(float deltaTime, const std::vector<sf::Event>& events)
+{
+    RecordedInputFrame& frame = m_frames.emplace_back();
+    frame.deltaTime           = deltaTime;
+    frame.events.reserve(events.size());
+    for (const sf::Event& event : events)
+    {
+        if (isRecordable(event))
+        {
+            frame.events.push_back(event);
+        }
+    }
+}
+
+bool InputRecording::isRecordable(const sf::Event& event)
+{
+    RecordedEventType type;
+    return toRecordedType(event.type, type);
+}
+
+size_t InputRecording::getEventCount() const
+{
+    size_t count = 0;
+    for (const RecordedInputFrame& frame : m_frames)
+    {
+        count += frame.events.size();
+    }
+    return count;
+}
+
+double InputRecording::getDuration() const
+{
+    double duration = 0.0;
+    for (const RecordedInputFrame& frame : m_frames)
+    {
+        duration += frame.deltaTime;
+    }
+    return duration;
+}
+
+std::vector<uint8_t> InputRecording::serialize() const
+{
+    std::vector<uint8_t> data;
+    ByteWriter           writer(data);
+
+    for (uint8_t byte : kMagic)
+    {
+        writer.u8(byte);
+    }
+    writer.u16(kVersion);
+    writer.u32(static_cast<uint32_t>(m_frames.size()));
+
+    for (const RecordedInputFrame& frame : m_frames)
+    {
+        writer.f32(frame.deltaTime);
+        writer.u32(static_cast<uint32_t>(frame.events.size()));
+        for (const sf::Event& event : frame.events)
+        {
+            RecordedEventType type;
+            if (toRecordedType(event.type, type))
+            {
+                writeEvent(writer, type, event);
+            }
+        }
+    }
+    return data;
+}
+
+bool InputRecording::deserialize(const uint8_t* data, size_t size)
+{
+    m_frames.clear();
+
+    ByteReader reader(data, size);
+    for (uint8_t expected : kMagic)
+    {
+        uint8_t byte;
+        if (!reader.u8(byte) || byte != expected)
+        {
+            return false;
+        }
+    }
+
+    uint16_t version;
+    uint32_t frameCount;
+    if (!reader.u16(version) || version != kVersion || !reader.u32(frameCount))
+    {
+        return false;
+    }
+
+    // Every frame takes at least 8 bytes, which bounds the reservation for corrupt headers
+    m_frames.reserve(std::min<size_t>(frameCount, reader.remaining() / 8));
+    for (uint32_t i = 0; i < frameCount; ++i)
+    {
+        RecordedInputFrame frame;
+        uint32_t           eventCount;
+        if (!reader.f32(frame.deltaTime) || !reader.u32(eventCount))
+        {
+            m_frames.clear();
+            return false;
+        }
+
+        frame.events.reserve(std::min<size_t>(eventCount, reader.remaining()));
+        for (uint32_t e = 0; e < eventCount; ++e)
+        {
+            sf::Event event;
+            if (!readEvent(reader, event))
+            {
+                m_frames.clear();
+                return false;
+            }
+            frame.events.push_back(event);
+        }
+        m_frames.push_back(std::move(frame));
+    }
+    return true;
+}
+
+bool InputRecording::saveToFile(const std::string& path) const
+{
+    const std::vector<uint8_t> data = serialize();
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())))
+    {
+        spdlog::error("InputRecording: failed to write '{}'", path);
+        return false;
+    }
+    return true;
+}
+
+bool InputRecording::loadFromFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        spdlog::error("InputRecording: failed to open '{}'", path);
+        m_frames.clear();
+        return false;
+    }
+
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!deserialize(data.data(), data.size()))
+    {
+        spdlog::error("InputRecording: '{}' is not a valid input recording", path);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace Systems
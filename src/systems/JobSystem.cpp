@@ -0,0 +1,287 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace Systems
+{
+
+namespace
+{
+// Identifies which JobSystem (if any) the current thread is a worker of, and its queue.
+thread_local const JobSystem* t_owner      = nullptr;
+thread_local size_t           t_queueIndex = 0;
+}  // namespace
+
+JobSystem::JobSystem(size_t workerCount) : m_mainThreadId(std::this_thread::get_id())
+{
+    if (workerCount == 0)
+    {
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        workerCount                        = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    m_queues.reserve(workerCount + 1);
+    for (size_t i = 0; i < workerCount + 1; ++i)
+    {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    m_workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, i + 1);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    m_running.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wake.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+void JobSystem::schedule(Job job, JobCounter* counter, JobCounter* dependency)
+{
+    if (counter)
+    {
+        counter->m_pending.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    Task task{std::move(job), counter};
+
+    if (dependency)
+    {
+        std::unique_lock<std::mutex> lock(dependency->m_mutex);
+        if (dependency->m_pending.load(std::memory_order_acquire) > 0)
+        {
+            // Released by finish() when the dependency's last job completes
+            auto shared = std::make_shared<Task>(std::move(task));
+            dependency->m_continuations.push_back([this, shared]() { enqueue(std::move(*shared)); });
+            return;
+        }
+    }
+
+    enqueue(std::move(task));
+}
+
+void JobSystem::scheduleMainThread(Job job, JobCounter* counter)
+{
+    if (counter)
+    {
+        counter->m_pending.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+    m_mainThreadJobs.push_back(Task{std::move(job), counter});
+}
+
+void JobSystem::parallelFor(size_t count, size_t grainSize, const RangeJob& job)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (grainSize == 0)
+    {
+        const size_t threads = m_workers.size() + 1;
+        grainSize            = std::max<size_t>(1, count / (threads * 4));
+    }
+
+    if (grainSize >= count)
+    {
+        job(0, count);
+        return;
+    }
+
+    JobCounter counter;
+    for (size_t begin = 0; begin < count; begin += grainSize)
+    {
+        const size_t end = std::min(count, begin + grainSize);
+        schedule([&job, begin, end]() { job(begin, end); }, &counter);
+    }
+    wait(counter);
+}
+
+void JobSystem::wait(JobCounter& counter)
+{
+    const size_t queueIndex = (t_owner == this) ? t_queueIndex : kInjectionQueue;
+
+    while (!counter.isDone())
+    {
+        if (isMainThread() && runMainThreadJobs() > 0)
+        {
+            continue;
+        }
+        if (!tryRunOne(queueIndex))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // The finishing thread releases this mutex last; taking it guarantees it is
+    // done touching the counter before the caller is allowed to destroy it.
+    std::lock_guard<std::mutex> lock(counter.m_mutex);
+}
+
+size_t JobSystem::runMainThreadJobs()
+{
+    assert(isMainThread() && "runMainThreadJobs must be called from the main thread");
+
+    std::deque<Task> jobs;
+    {
+        std::lock_guard<std::mutex> lock(m_mainThreadMutex);
+        jobs.swap(m_mainThreadJobs);
+    }
+
+    for (auto& task : jobs)
+    {
+        execute(task);
+    }
+    return jobs.size();
+}
+
+void JobSystem::workerLoop(size_t queueIndex)
+{
+    t_owner      = this;
+    t_queueIndex = queueIndex;
+
+    while (m_running.load(std::memory_order_acquire))
+    {
+        if (tryRunOne(queueIndex))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wake.wait(lock,
+                    [this]()
+                    {
+                        return !m_running.load(std::memory_order_acquire)
+                               || m_queuedJobs.load(std::memory_order_acquire) > 0;
+                    });
+    }
+
+    t_owner = nullptr;
+}
+
+void JobSystem::enqueue(Task task)
+{
+    const size_t queueIndex = (t_owner == this) ? t_queueIndex : kInjectionQueue;
+    {
+        WorkQueue&                  queue = *m_queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+        m_queuedJobs.fetch_add(1, std::memory_order_acq_rel);
+    }
+    notifyWork();
+}
+
+bool JobSystem::tryRunOne(size_t queueIndex)
+{
+    Task task;
+    if (popOwn(queueIndex, task) || steal(queueIndex, task))
+    {
+        execute(task);
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::popOwn(size_t queueIndex, Task& out)
+{
+    WorkQueue&                  queue = *m_queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+    {
+        return false;
+    }
+
+    // Workers run their newest job first (cache-warm); the injection queue stays FIFO
+    if (queueIndex == kInjectionQueue)
+    {
+        out = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+    }
+    else
+    {
+        out = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+    }
+    m_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+bool JobSystem::steal(size_t thiefIndex, Task& out)
+{
+    const size_t queueCount = m_queues.size();
+    for (size_t offset = 1; offset < queueCount; ++offset)
+    {
+        WorkQueue&                  victim = *m_queues[(thiefIndex + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.tasks.empty())
+        {
+            continue;
+        }
+
+        out = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        m_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+    return false;
+}
+
+void JobSystem::execute(Task& task)
+{
+    if (task.job)
+    {
+        task.job();
+    }
+    finish(task.counter);
+}
+
+void JobSystem::finish(JobCounter* counter)
+{
+    if (!counter)
+    {
+        return;
+    }
+
+    std::vector<std::function<void()>> ready;
+    {
+        std::lock_guard<std::mutex> lock(counter->m_mutex);
+        if (counter->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            ready.swap(counter->m_continuations);
+        }
+    }
+
+    // The counter may be destroyed from here on; only the continuations are touched
+    for (auto& continuation : ready)
+    {
+        continuation();
+    }
+}
+
+void JobSystem::notifyWork()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wake.notify_one();
+}
+
+}  // namespace Systems
@@ -0,0 +1,125 @@
+#include "RenderFrame.h"
+
+#include <algorithm>
+
+namespace Systems
+{
+
+namespace
+{
+bool isListPrimitive(sf::PrimitiveType primitive)
+{
+    return primitive == sf::Points || primitive == sf::Lines || primitive == sf::Triangles || primitive == sf::Quads;
+}
+
+bool canMerge(const RenderFrame&      frame,
+              const RenderBatch&      batch,
+              sf::PrimitiveType       primitive,
+              const sf::RenderStates& states,
+              const ShaderBinding&    binding)
+{
+    if (batch.primitive != primitive || !isListPrimitive(primitive) || batch.states.texture != states.texture
+        || batch.states.shader != states.shader || batch.states.blendMode != states.blendMode)
+    {
+        return false;
+    }
+
+    const UniformValue* batchValues = frame.uniforms.data() + batch.firstUniform;
+    return batch.uniforms == binding.uniforms && batch.uniformCount == binding.valueCount
+           && std::equal(batchValues, batchValues + batch.uniformCount, binding.values);
+}
+}  // namespace
+
+void RenderFrame::clear()
+{
+    vertices.clear();
+    batches.clear();
+    uniforms.clear();
+    passes.clear();
+    m_firstMergeableBatch = 0;
+}
+
+sf::Vertex* RenderFrame::append(sf::PrimitiveType        primitive,
+                                const sf::RenderStates& states,
+                                size_t                  vertexCount,
+                                const ShaderBinding&    binding)
+{
+    const size_t first = vertices.size();
+    vertices.resize(first + vertexCount);
+
+    if (batches.size() > m_firstMergeableBatch && canMerge(*this, batches.back(), primitive, states, binding))
+    {
+        batches.back().vertexCount += vertexCount;
+    }
+    else
+    {
+        RenderBatch& batch = batches.emplace_back();
+        batch.primitive    = primitive;
+        batch.states       = states;
+        batch.firstVertex  = first;
+        batch.vertexCount  = vertexCount;
+        batch.uniforms     = binding.uniforms;
+        batch.firstUniform = uniforms.size();
+        batch.uniformCount = binding.valueCount;
+        uniforms.insert(uniforms.end(), binding.values, binding.values + binding.valueCount);
+    }
+    return vertices.data() + first;
+}
+
+void RenderFrame::beginPass(sf::RenderTexture* target, sf::Vector2u size, const sf::View& view)
+{
+    if (inPass())
+    {
+        endPass();
+    }
+
+    RenderPass& pass      = passes.emplace_back();
+    pass.target           = target;
+    pass.size             = size;
+    pass.view             = view;
+    pass.firstBatch       = batches.size();
+    pass.batchCount       = kOpenPass;
+    pass.firstVertex      = vertices.size();
+    pass.firstUniform     = uniforms.size();
+    m_firstMergeableBatch = batches.size();
+}
+
+void RenderFrame::endPass()
+{
+    if (!inPass())
+    {
+        return;
+    }
+
+    RenderPass& pass      = passes.back();
+    pass.batchCount       = batches.size() - pass.firstBatch;
+    m_firstMergeableBatch = batches.size();
+}
+
+void RenderFrame::discardPass()
+{
+    if (passes.empty())
+    {
+        return;
+    }
+
+    const RenderPass& pass = passes.back();
+    batches.resize(pass.firstBatch);
+    vertices.resize(pass.firstVertex);
+    uniforms.resize(pass.firstUniform);
+    passes.pop_back();
+    m_firstMergeableBatch = batches.size();
+}
+
+void RenderFrame::dissolvePass()
+{
+    if (passes.empty())
+    {
+        return;
+    }
+
+    passes.pop_back();
+    m_firstMergeableBatch = batches.size();
+}
+
+}  // namespace Systems
@@ -0,0 +1,213 @@
+#include "RenderQueue.h"
+
+namespace Systems
+{
+
+void RenderQueue::beginSync()
+{
+    ++m_epoch;
+    m_syncedCount = 0;
+    m_changeCount = 0;
+    m_changedZ.clear();
+}
+
+void RenderQueue::sync(Entity entity, bool isParticleEmitter, int zIndex, uint64_t signature)
+{
+    const uint32_t slotIndex = slotIndexOf(entity, isParticleEmitter);
+    if (slotIndex >= m_slots.size())
+    {
+        m_slots.resize(slotIndex + 1);
+    }
+
+    Slot& slot = m_slots[slotIndex];
+    if (slot.live && slot.entity != entity)
+    {
+        // The index was recycled for a new entity since the old one was last drawn
+        recordChange(slot.zIndex);
+        erase(slotIndex);
+    }
+
+    if (!slot.live)
+    {
+        // An entity coming back (e.g. made visible again) keeps its last known batch key
+        const uint64_t batchKey = slot.entity == entity ? slot.batchKey : 0;
+        insert(slotIndex, entity, zIndex, batchKey);
+        slot.signature = signature;
+        markSynced(slot);
+        recordChange(zIndex);
+        return;
+    }
+
+    if (slot.syncEpoch != m_epoch)
+    {
+        markSynced(slot);
+    }
+
+    if (slot.zIndex != zIndex)
+    {
+        m_changedZ.push_back(slot.zIndex);  // The layer it leaves changes as well
+        recordChange(zIndex);
+        move(slotIndex, zIndex, slot.batchKey);
+    }
+
+    // Same place in the queue, different pixels; not a bucket change, so not counted
+    if (slot.signature != signature)
+    {
+        slot.signature = signature;
+        m_changedZ.push_back(zIndex);
+    }
+}
+
+void RenderQueue::endSync()
+{
+    if (m_syncedCount == m_liveCount)
+    {
+        return;
+    }
+
+    // Only buckets holding more entries than were synced into them lost any
+    const size_t          staleCount = m_liveCount - m_syncedCount;
+    std::vector<uint32_t> stale;
+    for (const auto& [key, bucket] : m_buckets)
+    {
+        const size_t synced = bucket.syncEpoch == m_epoch ? bucket.syncedCount : 0;
+        if (synced == bucket.slots.size())
+        {
+            continue;
+        }
+
+        for (uint32_t slotIndex : bucket.slots)
+        {
+            if (m_slots[slotIndex].syncEpoch != m_epoch)
+            {
+                stale.push_back(slotIndex);
+            }
+        }
+        if (stale.size() == staleCount)
+        {
+            break;
+        }
+    }
+
+    for (uint32_t slotIndex : stale)
+    {
+        recordChange(m_slots[slotIndex].zIndex);
+        erase(slotIndex);
+    }
+}
+
+void RenderQueue::setBatchKey(Entity entity, bool isParticleEmitter, uint64_t batchKey)
+{
+    const uint32_t slotIndex = slotIndexOf(entity, isParticleEmitter);
+    if (slotIndex >= m_slots.size())
+    {
+        return;
+    }
+
+    Slot& slot = m_slots[slotIndex];
+    if (slot.live && slot.entity == entity && slot.batchKey != batchKey)
+    {
+        recordChange(slot.zIndex);
+        move(slotIndex, slot.zIndex, batchKey);
+    }
+}
+
+bool RenderQueue::changedInRange(int minZ, int maxZ) const
+{
+    for (int zIndex : m_changedZ)
+    {
+        if (zIndex >= minZ && zIndex <= maxZ)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RenderQueue::clear()
+{
+    m_buckets.clear();
+    m_slots.clear();
+    m_liveCount   = 0;
+    m_syncedCount = 0;
+    m_changeCount = 0;
+    m_changedZ.clear();
+}
+
+void RenderQueue::recordChange(int zIndex)
+{
+    m_changedZ.push_back(zIndex);
+    ++m_changeCount;
+}
+
+void RenderQueue::markSynced(Slot& slot)
+{
+    slot.syncEpoch = m_epoch;
+    ++m_syncedCount;
+
+    Bucket& bucket = *slot.bucket;
+    if (bucket.syncEpoch != m_epoch)
+    {
+        bucket.syncEpoch   = m_epoch;
+        bucket.syncedCount = 0;
+    }
+    ++bucket.syncedCount;
+}
+
+void RenderQueue::insert(uint32_t slotIndex, Entity entity, int zIndex, uint64_t batchKey)
+{
+    Bucket& bucket = m_buckets[BucketKey(zIndex, batchKey)];
+
+    Slot& slot    = m_slots[slotIndex];
+    slot.entity   = entity;
+    slot.zIndex   = zIndex;
+    slot.batchKey = batchKey;
+    slot.position = static_cast<uint32_t>(bucket.slots.size());
+    slot.bucket   = &bucket;
+    slot.live     = true;
+
+    bucket.slots.push_back(slotIndex);
+    ++m_liveCount;
+}
+
+void RenderQueue::erase(uint32_t slotIndex)
+{
+    Slot&   slot   = m_slots[slotIndex];
+    Bucket& bucket = *slot.bucket;
+
+    const uint32_t last         = bucket.slots.back();
+    bucket.slots[slot.position] = last;
+    m_slots[last].position      = slot.position;
+    bucket.slots.pop_back();
+
+    if (slot.syncEpoch == m_epoch)
+    {
+        --m_syncedCount;
+        --bucket.syncedCount;
+    }
+    if (bucket.slots.empty())
+    {
+        m_buckets.erase(BucketKey(slot.zIndex, slot.batchKey));
+    }
+    slot.bucket = nullptr;
+    slot.live   = false;
+    --m_liveCount;
+}
+
+void RenderQueue::move(uint32_t slotIndex, int zIndex, uint64_t batchKey)
+{
+    Slot&        slot   = m_slots[slotIndex];
+    const Entity entity = slot.entity;
+    const bool   synced = slot.syncEpoch == m_epoch;
+
+    erase(slotIndex);
+    insert(slotIndex, entity, zIndex, batchKey);
+
+    // The synced count follows the entry into its new bucket
+    if (synced)
+    {
+        markSynced(slot);
+    }
+}
+
+}  // namespace Systems
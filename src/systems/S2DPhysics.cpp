@@ -1,6 +1,7 @@
 #include "S2DPhysics.h"
 #include <algorithm>
 #include <cstdint>
+#include <memory_resource>
 #include <utility>
 #include <vector>
 #include "CCollider2D.h"
@@ -70,6 +71,12 @@ void S2DPhysics::update(float deltaTime, World& world)
         });
 }
 
+void S2DPhysics::declareAccess(SystemAccess& access) const
+{
+    // Fixed-update callbacks registered by gameplay code run inside the step
+    access.exclusive().mainThread();
+}
+
 void S2DPhysics::setGravity(const b2Vec2& gravity)
 {
     b2World_SetGravity(m_worldId, gravity);
@@ -80,6 +87,21 @@ b2Vec2 S2DPhysics::getGravity() const
     return b2World_GetGravity(m_worldId);
 }
 
+size_t S2DPhysics::getBodyCount() const
+{
+    return static_cast<size_t>(b2World_GetCounts(m_worldId).bodyCount);
+}
+
+size_t S2DPhysics::getShapeCount() const
+{
+    return static_cast<size_t>(b2World_GetCounts(m_worldId).shapeCount);
+}
+
+float S2DPhysics::getLastStepMs() const
+{
+    return b2World_GetProfile(m_worldId).step;
+}
+
 void S2DPhysics::destroyBodyInternal(b2BodyId bodyId)
 {
     if (b2Body_IsValid(bodyId))
@@ -211,7 +233,7 @@ void S2DPhysics::ensureShapesForEntity(Entity entity, const ::Components::CColli
                     break;
                 }
 
-                std::vector<b2Vec2> points;
+                std::pmr::vector<b2Vec2> points(m_world ? m_world->frameMemory() : std::pmr::get_default_resource());
                 points.reserve(fixture.polygon.vertices.size());
                 std::transform(fixture.polygon.vertices.begin(),
                                fixture.polygon.vertices.end(),
@@ -445,6 +467,8 @@ void S2DPhysics::syncToTransform(Entity entity, ::Components::CTransform& transf
     float  angle = b2Rot_GetAngle(rot);
     b2Vec2 vel   = b2Body_GetLinearVelocity(bodyId);
 
+    // Keep the pre-step pose so the renderer can interpolate between fixed steps
+    transform.snapshot();
     transform.position = {pos.x, pos.y};
     transform.rotation = angle;
     transform.velocity = {vel.x, vel.y};
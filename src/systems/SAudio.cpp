@@ -5,6 +5,7 @@
 
 #include "CAudioListener.h"
 #include "CAudioSource.h"
+#include "Log.h"
 #include "World.h"
 
 #ifndef _WIN32
@@ -15,7 +16,11 @@
 namespace Systems
 {
 
-SAudio::SAudio(size_t poolSize) : m_soundPool(poolSize) {}
+// Every sf::Sound in the pool holds an OpenAL source, so the null backend keeps the pool empty
+SAudio::SAudio(size_t poolSize, AudioBackend backend)
+    : m_backend(backend), m_soundPool(backend == AudioBackend::Null ? 0 : poolSize)
+{
+}
 
 SAudio::~SAudio()
 {
@@ -89,6 +94,7 @@ void SAudio::shutdownInternal()
 
     m_entityToSlot.clear();
     m_soundBuffers.clear();
+    m_nullSounds.clear();
     m_musicPaths.clear();
     m_currentMusicId.clear();
     m_initialized = false;
@@ -104,6 +110,12 @@ bool SAudio::loadSound(const std::string& id, const std::string& filepath, Audio
 
     if (type == AudioType::SFX)
     {
+        if (m_backend == AudioBackend::Null)
+        {
+            m_nullSounds.insert(id);
+            return true;
+        }
+
         if (m_soundBuffers.find(id) != m_soundBuffers.end())
         {
             return true;
@@ -147,6 +159,11 @@ bool SAudio::loadSound(const std::string& id, const std::string& filepath, Audio
 
 void SAudio::unloadSound(const std::string& id)
 {
+    if (m_nullSounds.erase(id) > 0)
+    {
+        return;
+    }
+
     auto bufferIt = m_soundBuffers.find(id);
     if (bufferIt != m_soundBuffers.end())
     {
@@ -182,10 +199,15 @@ bool SAudio::playSfx(Entity entity, const std::string& id, bool loop, float volu
         return false;
     }
 
+    if (m_backend == AudioBackend::Null)
+    {
+        return m_nullSounds.count(id) > 0;
+    }
+
     auto bufferIt = m_soundBuffers.find(id);
     if (bufferIt == m_soundBuffers.end())
     {
-        spdlog::warn("Sound buffer '{}' not found", id);
+        GAMEENGINE_LOG_RATE_LIMITED(LogLevel::Warn, "Sound buffer '%s' not found", id.c_str());
         return false;
     }
 
@@ -194,7 +216,7 @@ bool SAudio::playSfx(Entity entity, const std::string& id, bool loop, float volu
     int slotIndex = findAvailableSlot();
     if (slotIndex < 0)
     {
-        spdlog::warn("Sound pool full, cannot play '{}'", id);
+        GAMEENGINE_LOG_RATE_LIMITED(LogLevel::Warn, "Sound pool full, cannot play '%s'", id.c_str());
         return false;
     }
 
@@ -273,6 +295,12 @@ bool SAudio::playMusic(const std::string& id, bool loop)
         return false;
     }
 
+    if (m_backend == AudioBackend::Null)
+    {
+        m_currentMusicId = id;
+        return true;
+    }
+
     if (m_currentMusic)
     {
         m_currentMusic->stop();
@@ -321,8 +349,8 @@ void SAudio::stopMusic()
     {
         m_currentMusic->stop();
         m_currentMusic.reset();
-        m_currentMusicId.clear();
     }
+    m_currentMusicId.clear();
 }
 
 void SAudio::pauseMusic()
@@ -454,6 +482,12 @@ void SAudio::updateEcs(float deltaTime, World& world)
         });
 }
 
+void SAudio::declareAccess(SystemAccess& access) const
+{
+    // The sound pool is also driven by direct play/stop calls from gameplay code on the main thread
+    access.reads<Components::CAudioListener>().writes<Components::CAudioSource>().mainThread();
+}
+
 int SAudio::findAvailableSlot()
 {
     for (size_t i = 0; i < m_soundPool.size(); ++i)
@@ -466,6 +500,12 @@ int SAudio::findAvailableSlot()
     return -1;
 }
 
+size_t SAudio::getActiveSlotCount() const
+{
+    return static_cast<size_t>(
+        std::count_if(m_soundPool.begin(), m_soundPool.end(), [](const SoundSlot& slot) { return slot.inUse; }));
+}
+
 float SAudio::calculateEffectiveSfxVolume(float baseVolume) const
 {
     return std::clamp(baseVolume * m_masterVolume, AudioConstants::MIN_VOLUME, AudioConstants::MAX_VOLUME);
@@ -41,6 +41,34 @@ void SInput::shutdown()
     m_subscribers.clear();
     m_listenerPointers.clear();
     m_nextBindingId = 1;
+    m_recording     = nullptr;
+    m_replay        = nullptr;
+    m_replayFrame   = 0;
+    m_recordedEvents.clear();
+}
+
+void SInput::startRecording(InputRecording& recording)
+{
+    m_recording = &recording;
+    m_recordedEvents.clear();
+}
+
+void SInput::stopRecording()
+{
+    m_recording = nullptr;
+    m_recordedEvents.clear();
+}
+
+void SInput::startReplay(const InputRecording& recording)
+{
+    m_replay      = recording.getFrameCount() > 0 ? &recording : nullptr;
+    m_replayFrame = 0;
+}
+
+void SInput::stopReplay()
+{
+    m_replay      = nullptr;
+    m_replayFrame = 0;
 }
 
 static KeyCode keyCodeFromSFML(sf::Keyboard::Key k)
@@ -228,6 +256,11 @@ void SInput::unbindAction(const std::string& actionName)
 
 void SInput::processEvent(const sf::Event& event)
 {
+    if (m_recording && InputRecording::isRecordable(event))
+    {
+        m_recordedEvents.push_back(event);
+    }
+
     bool imguiCaptured = false;
     if (m_passToImGui)
     {
@@ -406,7 +439,7 @@ void SInput::processEvent(const sf::Event& event)
     }
 }
 
-void SInput::update(float /*deltaTime*/, World& world)
+void SInput::update(float deltaTime, World& world)
 {
     // Clear transient states (pressed/released) at start of update
     for (auto& kv : m_actionStates)
@@ -417,13 +450,42 @@ void SInput::update(float /*deltaTime*/, World& world)
     m_keyRepeat.clear();
     m_mousePressed.clear();
     m_mouseReleased.clear();
-    if (!m_window)
-        return;
 
-    // Pump events
-    sf::Event event;
-    while (m_window->pollEvent(event))
-        processEvent(event);
+    if (m_replay)
+    {
+        // The recording alone drives input; live events are drained so the window stays responsive
+        sf::Event ignored;
+        while (m_window && m_window->pollEvent(ignored))
+        {
+        }
+
+        const std::vector<RecordedInputFrame>& frames = m_replay->getFrames();
+        if (m_replayFrame < frames.size())
+        {
+            for (const sf::Event& recorded : frames[m_replayFrame].events)
+            {
+                processEvent(recorded);
+            }
+        }
+        if (++m_replayFrame >= frames.size())
+        {
+            stopReplay();
+        }
+    }
+    else if (m_window)
+    {
+        // Pump events
+        sf::Event event;
+        while (m_window->pollEvent(event))
+            processEvent(event);
+    }
+
+    // Events injected since the last update were processed before this frame's, so they share its frame
+    if (m_recording)
+    {
+        m_recording->addFrame(deltaTime, m_recordedEvents);
+        m_recordedEvents.clear();
+    }
 
     // Ensure controller bindings are registered before evaluating action states
     registerControllerBindings(world);
@@ -536,6 +598,12 @@ void SInput::update(float /*deltaTime*/, World& world)
     updateControllerStates(world);
 }
 
+void SInput::declareAccess(SystemAccess& access) const
+{
+    // Polls the SFML window and invokes subscriber callbacks (arbitrary user code)
+    access.exclusive().mainThread();
+}
+
 std::string SInput::scopeAction(Entity entity, const std::string& actionName) const
 {
     return actionName + "@E" + std::to_string(entity.index) + "." + std::to_string(entity.generation);
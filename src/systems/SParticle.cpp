@@ -2,6 +2,8 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <memory_resource>
 #include <random>
 #include "CParticleEmitter.h"
 #include "CTransform.h"
@@ -157,9 +159,10 @@ static std::pair<Vec2, Vec2> sampleLine(const Vec2& start, const Vec2& end)
 /**
  * @brief Sample a position on the edge of a polygon
  * @param vertices Polygon vertices (should form a closed shape)
+ * @param scratch Resource for the temporary edge lengths
  * @return Position on polygon edge and outward normal
  */
-static std::pair<Vec2, Vec2> samplePolygonEdge(const std::vector<Vec2>& vertices)
+static std::pair<Vec2, Vec2> samplePolygonEdge(const std::vector<Vec2>& vertices, std::pmr::memory_resource* scratch)
 {
     if (vertices.size() < 2)
     {
@@ -167,9 +170,10 @@ static std::pair<Vec2, Vec2> samplePolygonEdge(const std::vector<Vec2>& vertices
     }
 
     // Calculate total perimeter
-    float              totalPerimeter = 0.0f;
-    std::vector<float> edgeLengths;
-    size_t             numVertices = vertices.size();
+    float                   totalPerimeter = 0.0f;
+    std::pmr::vector<float> edgeLengths(scratch);
+    size_t                  numVertices = vertices.size();
+    edgeLengths.reserve(numVertices);
 
     for (size_t i = 0; i < numVertices; ++i)
     {
@@ -228,9 +232,12 @@ static std::pair<Vec2, Vec2> samplePolygonEdge(const std::vector<Vec2>& vertices
  * @brief Get emission position and optional outward direction based on emission shape
  * @param emitter The particle emitter component
  * @param entityRotation Rotation of the entity in radians
+ * @param scratch Resource for temporary per-spawn data
  * @return Local-space position offset and outward normal direction
  */
-static std::pair<Vec2, Vec2> getEmissionPositionAndNormal(const ::Components::CParticleEmitter* emitter, float entityRotation)
+static std::pair<Vec2, Vec2> getEmissionPositionAndNormal(const ::Components::CParticleEmitter* emitter,
+                                                          float                                 entityRotation,
+                                                          std::pmr::memory_resource*            scratch)
 {
     Vec2 localPosition(0.0f, 0.0f);
     Vec2 outwardNormal(0.0f, 1.0f);
@@ -271,7 +278,7 @@ static std::pair<Vec2, Vec2> getEmissionPositionAndNormal(const ::Components::CP
             const auto& vertices = emitter->getPolygonVertices();
             if (!vertices.empty())
             {
-                auto [pos, normal] = samplePolygonEdge(vertices);
+                auto [pos, normal] = samplePolygonEdge(vertices, scratch);
                 localPosition      = pos;
                 outwardNormal      = normal;
             }
@@ -318,14 +325,17 @@ static bool shouldEmitAtNormal(const Vec2& outwardNormal, const Vec2& velocity)
     return dot < 0.0f;
 }
 
-static ::Components::Particle spawnParticle(const ::Components::CParticleEmitter* emitter, const Vec2& worldPosition, float entityRotation)
+static ::Components::Particle spawnParticle(const ::Components::CParticleEmitter* emitter,
+                                            const Vec2&                           worldPosition,
+                                            float                                 entityRotation,
+                                            std::pmr::memory_resource*            scratch)
 {
     ::Components::Particle p;
     p.alive = true;
     p.age   = 0.0f;
 
     // Get emission position and outward normal based on shape
-    auto [shapeOffset, outwardNormal] = getEmissionPositionAndNormal(emitter, entityRotation);
+    auto [shapeOffset, outwardNormal] = getEmissionPositionAndNormal(emitter, entityRotation, scratch);
 
     // Position: world position + shape-based offset
     p.position = Vec2(worldPosition.x + shapeOffset.x, worldPosition.y + shapeOffset.y);
@@ -382,7 +392,9 @@ static ::Components::Particle spawnParticle(const ::Components::CParticleEmitter
     return p;
 }
 
-static void updateParticle(::Components::Particle& particle, const ::Components::CParticleEmitter* emitter, float deltaTime)
+static void updateParticle(::Components::Particle&             particle,
+                           const ::Components::ParticleEmitterConfig& config,
+                           float                                      deltaTime)
 {
     particle.age += deltaTime;
 
@@ -406,27 +418,34 @@ static void updateParticle(::Components::Particle& particle, const ::Components:
     float t = particle.age / particle.lifetime;
 
     // Color interpolation
-    particle.color = lerpColor(emitter->getStartColor(), emitter->getEndColor(), t);
+    particle.color = lerpColor(config.startColor, config.endColor, t);
 
     // Alpha fade
-    if (emitter->getFadeOut())
+    if (config.fadeOut)
     {
-        particle.alpha = lerp(emitter->getStartAlpha(), emitter->getEndAlpha(), t);
+        particle.alpha = lerp(config.startAlpha, config.endAlpha, t);
     }
 
     // Size shrink
-    if (emitter->getShrink())
+    if (config.shrink)
     {
-        particle.size = particle.initialSize * lerp(1.0f, emitter->getShrinkEndScale(), t);
+        particle.size = particle.initialSize * lerp(1.0f, config.shrinkEndScale, t);
     }
 }
 
-static void emitParticle(::Components::CParticleEmitter* emitter, const Vec2& worldPosition, float entityRotation)
+/**
+ * @brief Spawns one particle unless the emitter is at its limit
+ * @return The spawned particle, valid until the next spawn, or nullptr
+ */
+static const ::Components::Particle* emitParticle(::Components::CParticleEmitter* emitter,
+                                                  const Vec2&                     worldPosition,
+                                                  float                           entityRotation,
+                                                  std::pmr::memory_resource*      scratch)
 {
     // Check particle limit
     if (emitter->getAliveCount() >= static_cast<size_t>(emitter->getMaxParticles()))
     {
-        return;
+        return nullptr;
     }
 
     // Find dead particle to reuse or add new one
@@ -434,15 +453,37 @@ static void emitParticle(::Components::CParticleEmitter* emitter, const Vec2& wo
     auto it = std::find_if(particles.begin(), particles.end(), [](const ::Components::Particle& p) { return !p.alive; });
     if (it != particles.end())
     {
-        *it = spawnParticle(emitter, worldPosition, entityRotation);
-        return;
+        *it = spawnParticle(emitter, worldPosition, entityRotation, scratch);
+        return &*it;
     }
 
     // No dead particles, add new one
-    emitter->getParticles().push_back(spawnParticle(emitter, worldPosition, entityRotation));
+    particles.push_back(spawnParticle(emitter, worldPosition, entityRotation, scratch));
+    return &particles.back();
 }
 
-SParticle::SParticle() : m_vertexArray(sf::Quads), m_window(nullptr), m_pixelsPerMeter(100.0f), m_initialized(false) {}
+/**
+ * @brief Accumulates the world-space box of an emitter's live particles
+ */
+struct ParticleBounds
+{
+    Vec2 min{std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    Vec2 max{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    bool empty = true;
+
+    void add(const ::Components::Particle& particle)
+    {
+        // Particles are drawn as rotated squares extending size meters from their centre
+        const float extent = particle.size * 1.41421356f;
+        min.x              = std::min(min.x, particle.position.x - extent);
+        min.y              = std::min(min.y, particle.position.y - extent);
+        max.x              = std::max(max.x, particle.position.x + extent);
+        max.y              = std::max(max.y, particle.position.y + extent);
+        empty              = false;
+    }
+};
+
+SParticle::SParticle() : m_vertexArray(sf::Triangles), m_window(nullptr), m_pixelsPerMeter(100.0f), m_initialized(false) {}
 
 SParticle::~SParticle()
 {
@@ -470,8 +511,11 @@ void SParticle::update(float deltaTime, World& world)
         return;
     }
 
+    std::pmr::memory_resource* scratch       = world.frameMemory();
+    size_t                     liveParticles = 0;
     world.components().view2<::Components::CParticleEmitter, ::Components::CTransform>(
-        [deltaTime](Entity /*entity*/, ::Components::CParticleEmitter& emitter, ::Components::CTransform& transform)
+        [deltaTime, scratch, &liveParticles](
+            Entity /*entity*/, ::Components::CParticleEmitter& emitter, ::Components::CTransform& transform)
         {
             if (!emitter.isActive())
             {
@@ -493,11 +537,19 @@ void SParticle::update(float deltaTime, World& world)
 
             Vec2 worldPos = entityPos + offset;
 
+            // Resolve the cold config once per emitter rather than per particle
+            const ::Components::ParticleEmitterConfig& config = emitter.getConfig();
+            ParticleBounds                             bounds;
             for (auto& particle : emitter.getParticles())
             {
                 if (particle.alive)
                 {
-                    updateParticle(particle, &emitter, deltaTime);
+                    updateParticle(particle, config, deltaTime);
+                    if (particle.alive)
+                    {
+                        bounds.add(particle);
+                        ++liveParticles;
+                    }
                 }
             }
 
@@ -508,36 +560,118 @@ void SParticle::update(float deltaTime, World& world)
 
                 while (timer >= emissionInterval)
                 {
-                    emitParticle(&emitter, worldPos, rotation);
+                    if (const ::Components::Particle* spawned = emitParticle(&emitter, worldPos, rotation, scratch))
+                    {
+                        bounds.add(*spawned);
+                        ++liveParticles;
+                    }
                     timer -= emissionInterval;
                 }
                 emitter.setEmissionTimer(timer);
             }
+
+            // SRenderer culls the emitter against the view with this box
+            if (bounds.empty)
+            {
+                emitter.clearParticleBounds();
+            }
+            else
+            {
+                emitter.setParticleBounds(bounds.min, bounds.max);
+            }
         });
+
+    m_liveParticleCount = liveParticles;
+}
+
+void SParticle::declareAccess(SystemAccess& access) const
+{
+    access.reads<::Components::CTransform>().writes<::Components::CParticleEmitter>();
 }
 
 void SParticle::renderEmitter(Entity entity, sf::RenderWindow* window, World& world)
 {
     sf::RenderWindow* targetWindow = window ? window : m_window;
 
-    if (m_initialized == false || targetWindow == nullptr || !entity.isValid())
+    if (m_initialized == false || targetWindow == nullptr)
     {
         return;
     }
 
+    const sf::Texture* texture = buildEmitterVertices(entity, world, m_vertexArray);
+
+    // Render particles for this emitter
+    if (m_vertexArray.getVertexCount() > 0)
+    {
+        sf::RenderStates states;
+        states.blendMode = sf::BlendAlpha;
+
+        if (texture)
+        {
+            states.texture = texture;
+        }
+
+        targetWindow->draw(m_vertexArray, states);
+    }
+}
+
+const sf::Texture* SParticle::buildEmitterVertices(Entity entity, World& world, sf::VertexArray& vertices)
+{
+    vertices.clear();
+    vertices.setPrimitiveType(sf::Triangles);
+
+    if (m_initialized == false || !entity.isValid())
+    {
+        return nullptr;
+    }
+
     auto* emitter = world.components().tryGet<::Components::CParticleEmitter>(entity);
     if (!emitter)
+    {
+        return nullptr;
+    }
+
+    // The path is only read the first time a handle is seen
+    const AssetHandle  handle  = emitter->getTextureHandle();
+    const sf::Texture* texture = m_textures.resolve(handle, [&] { return loadTexture(AssetHandles::keyOf(handle)); });
+    sf::FloatRect      texRect;
+    if (texture)
+    {
+        texRect = sf::FloatRect(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(texture->getSize()));
+    }
+
+    appendParticles(*emitter, texRect, vertices);
+    return texture;
+}
+
+void SParticle::buildEmitterVertices(Entity               entity,
+                                     World&               world,
+                                     const TextureRegion* region,
+                                     sf::VertexArray&     vertices)
+{
+    vertices.clear();
+    vertices.setPrimitiveType(sf::Triangles);
+
+    if (m_initialized == false || !entity.isValid())
     {
         return;
     }
 
-    const sf::Texture* texture = loadTexture(emitter->getTexturePath());
+    auto* emitter = world.components().tryGet<::Components::CParticleEmitter>(entity);
+    if (!emitter)
+    {
+        return;
+    }
 
-    // Clear vertex array for this emitter
-    m_vertexArray.clear();
+    appendParticles(*emitter, region ? region->rect : sf::FloatRect(), vertices);
+}
 
+void SParticle::appendParticles(const ::Components::CParticleEmitter& emitter,
+                                const sf::FloatRect&                  texRect,
+                                sf::VertexArray&                      vertices) const
+{
     // Build vertex array for all alive particles
-    for (const auto& particle : emitter->getParticles())
+    for (const auto& particle : emitter.getParticles())
     {
         if (particle.alive == false)
         {
@@ -551,85 +685,52 @@ void SParticle::renderEmitter(Entity entity, sf::RenderWindow* window, World& wo
         // Create color with alpha
         sf::Color color(particle.color.r, particle.color.g, particle.color.b, static_cast<sf::Uint8>(particle.alpha * 255.0f));
 
-        if (texture)
+        // Rotated square around the particle, as two triangles so it batches with sprites and shapes
+        const float  cosR       = std::cos(particle.rotation);
+        const float  sinR       = std::sin(particle.rotation);
+        sf::Vector2f corners[4] = {
+            sf::Vector2f(-pixelSize, -pixelSize),  // Top-left
+            sf::Vector2f(pixelSize, -pixelSize),   // Top-right
+            sf::Vector2f(pixelSize, pixelSize),    // Bottom-right
+            sf::Vector2f(-pixelSize, pixelSize)    // Bottom-left
+        };
+        for (sf::Vector2f& corner : corners)
         {
-            // Textured quad
-            float cosR = std::cos(particle.rotation);
-            float sinR = std::sin(particle.rotation);
-
-            // Quad corners (centered)
-            sf::Vector2f corners[4] = {
-                sf::Vector2f(-pixelSize, -pixelSize),  // Top-left
-                sf::Vector2f(pixelSize, -pixelSize),   // Top-right
-                sf::Vector2f(pixelSize, pixelSize),    // Bottom-right
-                sf::Vector2f(-pixelSize, pixelSize)    // Bottom-left
-            };
-
-            // Rotate corners
-            for (int i = 0; i < 4; ++i)
-            {
-                float x      = corners[i].x;
-                float y      = corners[i].y;
-                corners[i].x = x * cosR - y * sinR;
-                corners[i].y = x * sinR + y * cosR;
-                corners[i] += screenPos;
-            }
-
-            // Texture coordinates (in pixels for SFML - confirmed by official docs)
-            sf::Vector2u texSize      = texture->getSize();
-            sf::Vector2f texCoords[4] = {
-                sf::Vector2f(0.0f, 0.0f),                                                    // Top-left
-                sf::Vector2f(static_cast<float>(texSize.x), 0.0f),                           // Top-right
-                sf::Vector2f(static_cast<float>(texSize.x), static_cast<float>(texSize.y)),  // Bottom-right
-                sf::Vector2f(0.0f, static_cast<float>(texSize.y))                            // Bottom-left
-            };
-
-            // Add vertices
-            for (int i = 0; i < 4; ++i)
-            {
-                m_vertexArray.append(sf::Vertex(corners[i], color, texCoords[i]));
-            }
+            const float x = corner.x;
+            const float y = corner.y;
+            corner        = sf::Vector2f(x * cosR - y * sinR, x * sinR + y * cosR) + screenPos;
         }
-        else
-        {
-            // Colored quad (no texture)
-            float cosR = std::cos(particle.rotation);
-            float sinR = std::sin(particle.rotation);
 
-            sf::Vector2f corners[4] = {sf::Vector2f(-pixelSize, -pixelSize),
-                                       sf::Vector2f(pixelSize, -pixelSize),
-                                       sf::Vector2f(pixelSize, pixelSize),
-                                       sf::Vector2f(-pixelSize, pixelSize)};
+        // Texture coordinates in pixels; untextured particles leave them at zero
+        const float        right        = texRect.left + texRect.width;
+        const float        bottom       = texRect.top + texRect.height;
+        const sf::Vector2f texCoords[4] = {sf::Vector2f(texRect.left, texRect.top),
+                                           sf::Vector2f(right, texRect.top),
+                                           sf::Vector2f(right, bottom),
+                                           sf::Vector2f(texRect.left, bottom)};
+        const int          order[6]     = {0, 1, 2, 0, 2, 3};
 
-            for (int i = 0; i < 4; ++i)
-            {
-                float x      = corners[i].x;
-                float y      = corners[i].y;
-                corners[i].x = x * cosR - y * sinR;
-                corners[i].y = x * sinR + y * cosR;
-                corners[i] += screenPos;
-            }
-
-            for (int i = 0; i < 4; ++i)
-            {
-                m_vertexArray.append(sf::Vertex(corners[i], color));
-            }
+        for (int i : order)
+        {
+            vertices.append(sf::Vertex(corners[i], color, texCoords[i]));
         }
     }
+}
 
-    // Render particles for this emitter
-    if (m_vertexArray.getVertexCount() > 0)
-    {
-        sf::RenderStates states;
-        states.blendMode = sf::BlendAlpha;
-
-        if (texture)
-        {
-            states.texture = texture;
-        }
+bool SParticle::getEmitterScreenBounds(Entity entity, World& world, sf::Vector2f& min, sf::Vector2f& max) const
+{
+    auto* emitter = world.components().tryGet<::Components::CParticleEmitter>(entity);
 
-        targetWindow->draw(m_vertexArray, states);
+    Vec2 worldMin, worldMax;
+    if (!emitter || !emitter->getParticleBounds(worldMin, worldMax))
+    {
+        return false;
     }
+
+    // World Y grows upwards, screen Y downwards, so the corners swap vertically
+    min = worldToScreen(Vec2(worldMin.x, worldMax.y));
+    max = worldToScreen(Vec2(worldMax.x, worldMin.y));
+    return true;
 }
 
 sf::Vector2f SParticle::worldToScreen(const Vec2& worldPos) const
@@ -1,6 +1,10 @@
 #include "SRenderer.h"
 #include <spdlog/spdlog.h>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
 #include "CCollider2D.h"
 #include "CMaterial.h"
 #include "CParticleEmitter.h"
@@ -8,7 +12,11 @@
 #include "CShader.h"
 #include "CTexture.h"
 #include "CTransform.h"
+#include "GeometryTemplates.h"
+#include "Log.h"
+#include "Profiler.h"
 #include "SParticle.h"
+#include "SystemLocator.h"
 #include "World.h"
 
 namespace Systems
@@ -19,6 +27,208 @@ static sf::Color toSFMLColor(const Color& c)
     return sf::Color(c.r, c.g, c.b, c.a);
 }
 
+/// Conversion from physics meters to screen pixels
+static constexpr float PIXELS_PER_METER = 100.0f;
+
+/**
+ * @brief Writes a size.x by size.y rectangle as two triangles
+ * @param out Six vertices to fill
+ * @param transform Places the rectangle's local (0,0)-size corners on screen
+ * @param texRect Texture pixels mapped onto the rectangle (empty when untextured)
+ */
+static void writeQuad(sf::Vertex*          out,
+                      const sf::Transform& transform,
+                      sf::Vector2f         size,
+                      sf::Color            color,
+                      const sf::FloatRect& texRect)
+{
+    const float        left       = texRect.left;
+    const float        top        = texRect.top;
+    const float        right      = texRect.left + texRect.width;
+    const float        bottom     = texRect.top + texRect.height;
+    const sf::Vector2f corners[4] = {{0.0f, 0.0f}, {size.x, 0.0f}, {size.x, size.y}, {0.0f, size.y}};
+    const sf::Vector2f uvs[4]     = {{left, top}, {right, top}, {right, bottom}, {left, bottom}};
+    const int          order[6]   = {0, 1, 2, 0, 2, 3};
+
+    for (int i = 0; i < 6; ++i)
+    {
+        out[i] = sf::Vertex(transform.transformPoint(corners[order[i]]), color, uvs[order[i]]);
+    }
+}
+
+/**
+ * @brief Writes a circle of the given radius, centred on local (radius, radius), as a triangle list
+ * @param out segments * 3 vertices to fill
+ * @param segments Level of detail from GeometryTemplates::circleSegments()
+ * @param texRect Texture pixels stretched over the circle's bounding box (empty when untextured)
+ */
+static void writeCircle(sf::Vertex*          out,
+                        const sf::Transform& transform,
+                        float                radius,
+                        size_t               segments,
+                        sf::Color            color,
+                        const sf::FloatRect& texRect)
+{
+    const sf::Vector2f* unit = GeometryTemplates::unitCircle(segments);
+    const sf::Vector2f  uvScale(texRect.width / 2.0f, texRect.height / 2.0f);
+    const sf::Vector2f  centerUv(texRect.left + uvScale.x, texRect.top + uvScale.y);
+
+    auto point = [&](size_t i)
+    {
+        const sf::Vector2f local(radius + unit[i].x * radius, radius + unit[i].y * radius);
+        const sf::Vector2f uv(centerUv.x + unit[i].x * uvScale.x, centerUv.y + unit[i].y * uvScale.y);
+        return sf::Vertex(transform.transformPoint(local), color, uv);
+    };
+
+    const sf::Vertex center(transform.transformPoint(radius, radius), color, centerUv);
+    sf::Vertex       previous = point(0);
+    for (size_t i = 1; i <= segments; ++i)
+    {
+        const sf::Vertex next = point(i % segments);
+        *out++                = center;
+        *out++                = previous;
+        *out++                = next;
+        previous              = next;
+    }
+}
+
+/**
+ * @brief Identifies the render state of a draw, so RenderQueue can place draws that batch together side by side
+ */
+static uint64_t batchKeyOf(sf::PrimitiveType        primitive,
+                           const sf::RenderStates& states,
+                           const ShaderBinding&    binding = ShaderBinding())
+{
+    constexpr uint64_t kMix = 0x9E3779B97F4A7C15ull;
+
+    const sf::BlendMode& blend = states.blendMode;
+    const uint64_t blendBits   = (static_cast<uint64_t>(blend.colorSrcFactor) << 0)
+                               | (static_cast<uint64_t>(blend.colorDstFactor) << 4)
+                               | (static_cast<uint64_t>(blend.colorEquation) << 8)
+                               | (static_cast<uint64_t>(blend.alphaSrcFactor) << 12)
+                               | (static_cast<uint64_t>(blend.alphaDstFactor) << 16)
+                               | (static_cast<uint64_t>(blend.alphaEquation) << 20)
+                               | (static_cast<uint64_t>(primitive) << 24);
+
+    // Mix texture, blend mode and shader parameters; equal states always give equal keys
+    uint64_t key = reinterpret_cast<uintptr_t>(states.texture);
+    key          = key * kMix ^ blendBits;
+    for (size_t i = 0; i < binding.valueCount; ++i)
+    {
+        const UniformValue& value = binding.values[i];
+        key                       = key * kMix ^ value.name;
+        for (uint8_t c = 0; c < value.components; ++c)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value.value[c], sizeof(bits));
+            key = key * kMix ^ bits;
+        }
+    }
+
+    // The shader takes the top bits, so each z layer visits all draws of one shader before the next
+    const uint64_t shaderBits = states.shader ? ((reinterpret_cast<uintptr_t>(states.shader) * kMix) >> 48) | 1 : 0;
+    return (shaderBits << 48) | (key & 0xFFFFFFFFFFFFull);
+}
+
+/**
+ * @brief Hashes everything that decides a renderable's pixels, so a static layer notices when any of it is edited
+ */
+static uint64_t renderSignatureOf(Entity                           entity,
+                                  const ::Components::CRenderable& renderable,
+                                  const ::Components::CTransform&  transform,
+                                  World::Components&               components,
+                                  float                            interpolationAlpha)
+{
+    constexpr uint64_t kMix = 0x9E3779B97F4A7C15ull;
+
+    uint64_t key = 0;
+    auto     mix = [&key](uint64_t bits) { key = key * kMix ^ bits; };
+
+    auto mixFloat = [&mix](float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        mix(bits);
+    };
+    auto mixColor = [&mix](const Color& color)
+    {
+        mix((static_cast<uint64_t>(color.r) << 24) | (static_cast<uint64_t>(color.g) << 16)
+            | (static_cast<uint64_t>(color.b) << 8) | color.a);
+    };
+
+    const Vec2 position = transform.getInterpolatedPosition(interpolationAlpha);
+    mixFloat(position.x);
+    mixFloat(position.y);
+    mixFloat(transform.getInterpolatedRotation(interpolationAlpha));
+    mixFloat(transform.getScale().x);
+    mixFloat(transform.getScale().y);
+
+    mix(static_cast<uint64_t>(renderable.getVisualType()));
+    mixColor(renderable.getColor());
+    mixFloat(renderable.getLineStart().x);
+    mixFloat(renderable.getLineStart().y);
+    mixFloat(renderable.getLineEnd().x);
+    mixFloat(renderable.getLineEnd().y);
+    mixFloat(renderable.getLineThickness());
+
+    if (const auto* material = components.tryGet<::Components::CMaterial>(entity))
+    {
+        mixColor(material->getTint());
+        mix(static_cast<uint64_t>(material->getBlendMode()));
+        mixFloat(material->getOpacity());
+    }
+    if (const auto* texture = components.tryGet<::Components::CTexture>(entity))
+    {
+        mix(texture->getTextureHandle());
+    }
+    if (const auto* shader = components.tryGet<::Components::CShader>(entity))
+    {
+        mix(shader->getShaderHandle());
+    }
+    if (const auto* collider = components.tryGet<::Components::CCollider2D>(entity))
+    {
+        // Sprites are sized from a box collider
+        mixFloat(collider->getBoxHalfWidth());
+        mixFloat(collider->getBoxHalfHeight());
+    }
+    return key;
+}
+
+/**
+ * @brief Everything about a view that decides where a static layer's pixels land
+ */
+static std::array<float, 9> viewStateOf(const sf::View& view)
+{
+    const sf::FloatRect& viewport = view.getViewport();
+    return {view.getCenter().x,
+            view.getCenter().y,
+            view.getSize().x,
+            view.getSize().y,
+            view.getRotation(),
+            viewport.left,
+            viewport.top,
+            viewport.width,
+            viewport.height};
+}
+
+/**
+ * @brief Whether the screen-space box [min, max] lies entirely outside view
+ */
+static bool outsideView(const sf::FloatRect& view, sf::Vector2f min, sf::Vector2f max)
+{
+    return max.x < view.left || min.x > view.left + view.width || max.y < view.top || min.y > view.top + view.height;
+}
+
+/**
+ * @brief Screen transform of a shape: origin, then scale, rotation (degrees) and position
+ */
+static sf::Transform makeTransform(sf::Vector2f position, float degrees, sf::Vector2f scale, sf::Vector2f origin)
+{
+    sf::Transform transform;
+    transform.translate(position).rotate(degrees).scale(scale).translate(-origin);
+    return transform;
+}
+
 SRenderer::SRenderer() : System() {}
 
 SRenderer::~SRenderer()
@@ -48,12 +258,9 @@ bool SRenderer::initialize(const WindowConfig& config)
         return false;
     }
 
-    // Apply window settings
+    // Apply window settings. frameLimit is enforced by GameEngine's FramePacer: SFML's own
+    // limiter sleeps with millisecond granularity and jitters at high refresh rates.
     m_window->setVerticalSyncEnabled(config.vsync);
-    if (config.frameLimit > 0)
-    {
-        m_window->setFramerateLimit(config.frameLimit);
-    }
 
     m_initialized = true;
     spdlog::info("SRenderer: Initialized with window size {}x{}", config.width, config.height);
@@ -69,6 +276,8 @@ void SRenderer::shutdown()
 
     clearTextureCache();
     clearShaderCache();
+    clearStaticLayers();
+    m_renderQueue.clear();
 
     if (m_window)
     {
@@ -88,60 +297,471 @@ void SRenderer::update(float deltaTime, World& world)
     // Actual rendering is done in render()
 }
 
-void SRenderer::render(World& world)
+void SRenderer::render(World& world, float interpolationAlpha)
 {
+    GAMEENGINE_PROFILE_SCOPE("SRenderer::render");
+
+    uploadPendingAssets();
+    buildFrame(world, interpolationAlpha, m_frame);
+    submitFrame(m_frame);
+}
+
+void SRenderer::buildFrame(World& world, float interpolationAlpha, RenderFrame& frame)
+{
+    GAMEENGINE_PROFILE_SCOPE("SRenderer::buildFrame");
+
+    frame.clear();
+    m_lastQueueLength       = 0;
+    m_lastQueueChanges      = 0;
+    m_lastParticleVertices  = 0;
+    m_lastBatches           = 0;
+    m_lastVertices          = 0;
+    m_lastCulledRenderables = 0;
+    m_lastCulledEmitters    = 0;
+    m_lastCachedRenderables = 0;
+    m_lastLayerRebuilds     = 0;
+
     if (!m_initialized || !m_window || !m_window->isOpen())
     {
         return;
     }
 
-    struct RenderItem
+    m_interpolationAlpha = interpolationAlpha;
+
+    // Static layers whose render texture could not be created are drawn directly from now on
     {
-        Entity entity;
-        int    zIndex;
-        bool   isParticleEmitter;
-    };
+        std::lock_guard<std::mutex> lock(m_failedLayerMutex);
+        for (const sf::RenderTexture* target : m_failedLayerTargets)
+        {
+            for (StaticLayer& layer : m_staticLayers)
+            {
+                if (layer.texture.get() == target && !layer.failed)
+                {
+                    spdlog::warn("SRenderer: Drawing static layer {}..{} uncached", layer.minZ, layer.maxZ);
+                    layer.failed = true;
+                    layer.valid  = false;
+                }
+            }
+        }
+        m_failedLayerTargets.clear();
+    }
+
+    const sf::Vector2u windowSize = m_window->getSize();
+    frame.shaderTime              = m_shaderClock.getElapsedTime().asSeconds();
+    frame.resolution              = sf::Vector2f(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y));
 
-    std::vector<RenderItem> renderQueue;
+    // Draws entirely outside the window's current view are skipped; a rotated view is covered by its circumscribed box
+    const sf::View& view   = m_window->getView();
+    sf::Vector2f    extent = view.getSize() / 2.0f;
+    if (view.getRotation() != 0.0f)
+    {
+        const float radius = std::hypot(extent.x, extent.y);
+        extent             = sf::Vector2f(radius, radius);
+    }
+    m_viewBounds = sf::FloatRect(view.getCenter() - extent, extent * 2.0f);
 
     auto components = world.components();
 
+    // Reconcile the persistent queue; only entities that appeared, left or changed z are re-bucketed
+    m_renderQueue.beginSync();
     components.view2<::Components::CRenderable, ::Components::CTransform>(
-        [&renderQueue](Entity entity, ::Components::CRenderable& renderable, ::Components::CTransform&)
+        [this, &components](Entity entity, ::Components::CRenderable& renderable, ::Components::CTransform& transform)
         {
             if (!renderable.isVisible())
             {
                 return;
             }
-            renderQueue.push_back({entity, renderable.getZIndex(), false});
+
+            // Entries of cached layers also carry a signature, so moving or restyling one re-records its layer
+            const int zIndex    = renderable.getZIndex();
+            uint64_t  signature = 0;
+            if (isInStaticLayer(zIndex))
+            {
+                signature = renderSignatureOf(entity, renderable, transform, components, m_interpolationAlpha);
+            }
+            m_renderQueue.sync(entity, false, zIndex, signature);
         });
 
     components.view2<::Components::CParticleEmitter, ::Components::CTransform>(
-        [&renderQueue](Entity entity, ::Components::CParticleEmitter& emitter, ::Components::CTransform&)
+        [this](Entity entity, ::Components::CParticleEmitter& emitter, ::Components::CTransform&)
         {
             if (emitter.isActive())
             {
-                renderQueue.push_back({entity, emitter.getZIndex(), true});
+                m_renderQueue.sync(entity, true, emitter.getZIndex());
             }
         });
+    m_renderQueue.endSync();
+    m_lastQueueLength = m_renderQueue.size();
 
-    std::sort(renderQueue.begin(),
-              renderQueue.end(),
-              [](const RenderItem& a, const RenderItem& b) { return a.zIndex < b.zIndex; });
+    // Entries whose render state differs from their bucket's move next frame, once iteration is done
+    std::pmr::vector<RenderQueueEntry> rekeyed(world.frameMemory());
 
-    for (const RenderItem& item : renderQueue)
+    auto drawEntry = [&](const RenderQueueEntry& item)
     {
+        uint64_t batchKey = 0;
         if (item.isParticleEmitter)
         {
-            if (m_particleSystem && m_particleSystem->isInitialized())
+            if (cullEmitter(item.entity, world))
             {
-                m_particleSystem->renderEmitter(item.entity, m_window.get(), world);
+                // Keep its place in the queue; its render state has not changed
+                batchKey = item.batchKey;
+            }
+            else if (m_particleSystem && m_particleSystem->isInitialized())
+            {
+                // Emitter textures live in the same atlas as sprites, so their triangles batch together
+                const auto*          emitter = world.components().get<::Components::CParticleEmitter>(item.entity);
+                const TextureRegion* region  = resolveTexture(emitter->getTextureHandle());
+                m_particleSystem->buildEmitterVertices(item.entity, world, region, m_particleScratch);
+                const size_t count = m_particleScratch.getVertexCount();
+                m_lastParticleVertices += count;
+
+                sf::RenderStates states;
+                states.blendMode = sf::BlendAlpha;
+                states.texture   = region ? region->texture : nullptr;
+                batchKey         = batchKeyOf(m_particleScratch.getPrimitiveType(), states);
+
+                if (count > 0)
+                {
+                    sf::Vertex* out = frame.append(m_particleScratch.getPrimitiveType(), states, count);
+                    std::copy(&m_particleScratch[0], &m_particleScratch[0] + count, out);
+                }
             }
+        }
+        else
+        {
+            batchKey = renderEntity(item.entity, world, frame);
+        }
+
+        if (batchKey != item.batchKey)
+        {
+            rekeyed.push_back({item.entity, item.isParticleEmitter, item.zIndex, batchKey});
+        }
+    };
+
+    // Z ranges between static layers go straight to the window; each static layer is recorded on its own
+    int  nextZ      = std::numeric_limits<int>::min();
+    bool reachedTop = false;
+    for (StaticLayer& layer : m_staticLayers)
+    {
+        if (layer.minZ > nextZ)
+        {
+            m_renderQueue.eachInRange(nextZ, layer.minZ - 1, drawEntry);
+        }
+        buildStaticLayer(layer, frame, drawEntry);
+        if (layer.maxZ == std::numeric_limits<int>::max())
+        {
+            reachedTop = true;
+            break;
+        }
+        nextZ = layer.maxZ + 1;
+    }
+    if (!reachedTop)
+    {
+        m_renderQueue.eachInRange(nextZ, std::numeric_limits<int>::max(), drawEntry);
+    }
+
+    for (const RenderQueueEntry& entry : rekeyed)
+    {
+        m_renderQueue.setBatchKey(entry.entity, entry.isParticleEmitter, entry.batchKey);
+
+        // A texture, blend or shader change can make a directly drawn static layer cacheable again
+        invalidateStaticLayer(entry.zIndex);
+    }
+
+    m_lastQueueChanges = m_renderQueue.getChangeCount();
+    m_lastBatches      = frame.batches.size();
+    m_lastVertices     = frame.vertices.size();
+}
+
+void SRenderer::submitFrame(const RenderFrame& frame)
+{
+    GAMEENGINE_PROFILE_SCOPE("SRenderer::submitFrame");
+
+    if (!m_window || !m_window->isOpen())
+    {
+        return;
+    }
+
+    // Static layers being rebuilt are rasterized before the window draws that blit them
+    size_t drawCalls = 0;
+    for (const RenderPass& pass : frame.passes)
+    {
+        sf::RenderTexture& target = *pass.target;
+        if (target.getSize() != pass.size)
+        {
+            sf::ContextSettings settings;
+            settings.antialiasingLevel = m_window->getSettings().antialiasingLevel;
+            if (!target.create(pass.size.x, pass.size.y, settings))
+            {
+                // The next buildFrame() draws the layer directly; until then its blit is skipped
+                spdlog::error("SRenderer: Failed to create a {}x{} static layer texture", pass.size.x, pass.size.y);
+                std::lock_guard<std::mutex> lock(m_failedLayerMutex);
+                m_failedLayerTargets.push_back(&target);
+                continue;
+            }
+        }
+
+        target.setView(pass.view);
+        target.clear(sf::Color::Transparent);
+        drawCalls += drawBatches(target, frame, pass.firstBatch, pass.firstBatch + pass.batchCount);
+        target.display();
+    }
+
+    size_t next = 0;
+    for (const RenderPass& pass : frame.passes)
+    {
+        drawCalls += drawBatches(*m_window, frame, next, pass.firstBatch);
+        next = pass.firstBatch + pass.batchCount;
+    }
+    drawCalls += drawBatches(*m_window, frame, next, frame.batches.size());
+    m_lastDrawCalls.store(drawCalls, std::memory_order_relaxed);
+}
+
+size_t SRenderer::drawBatches(sf::RenderTarget& target, const RenderFrame& frame, size_t first, size_t last)
+{
+    size_t drawCalls = 0;
+    for (size_t i = first; i < last; ++i)
+    {
+        const RenderBatch& batch = frame.batches[i];
+        if (batch.states.texture && batch.states.texture->getSize().x == 0)
+        {
+            // Blit of a static layer whose render texture could not be created
             continue;
         }
 
-        renderEntity(item.entity, world);
+        if (batch.uniforms)
+        {
+            // Each call only reaches setUniform for values the program does not hold yet
+            batch.uniforms->applyFrame(frame.shaderTime, frame.resolution);
+            batch.uniforms->apply(frame.uniforms.data() + batch.firstUniform, batch.uniformCount);
+        }
+
+        target.draw(frame.vertices.data() + batch.firstVertex, batch.vertexCount, batch.primitive, batch.states);
+        ++drawCalls;
     }
+    return drawCalls;
+}
+
+template <typename Func>
+void SRenderer::buildStaticLayer(StaticLayer& layer, RenderFrame& frame, Func& drawEntry)
+{
+    if (layer.failed)
+    {
+        m_renderQueue.eachInRange(layer.minZ, layer.maxZ, drawEntry);
+        return;
+    }
+
+    // Queue changes include entries whose render signature changed, e.g. a moved or recolored entity
+    const sf::Vector2u         windowSize  = m_window->getSize();
+    const sf::View&            view        = m_window->getView();
+    const std::array<float, 9> viewState   = viewStateOf(view);
+    const bool                 viewChanged = layer.windowSize != windowSize || layer.viewState != viewState;
+
+    const bool changed = layer.dirty || viewChanged || m_renderQueue.changedInRange(layer.minZ, layer.maxZ);
+
+    if (!changed && layer.valid)
+    {
+        // Nothing is recorded; the entries keep the batch keys they were rasterized with
+        m_renderQueue.eachInRange(layer.minZ,
+                                  layer.maxZ,
+                                  [this](const RenderQueueEntry&) { ++m_lastCachedRenderables; });
+        appendLayerBlit(layer, frame, view, windowSize);
+        return;
+    }
+    if (!changed && !layer.cacheable)
+    {
+        m_renderQueue.eachInRange(layer.minZ, layer.maxZ, drawEntry);
+        return;
+    }
+
+    bool hasEmitter = false;
+    frame.beginPass(layer.texture.get(), windowSize, view);
+    m_renderQueue.eachInRange(layer.minZ,
+                              layer.maxZ,
+                              [&](const RenderQueueEntry& item)
+                              {
+                                  hasEmitter = hasEmitter || item.isParticleEmitter;
+                                  drawEntry(item);
+                              });
+    frame.endPass();
+
+    layer.dirty      = false;
+    layer.windowSize = windowSize;
+    layer.viewState  = viewState;
+    layer.valid      = false;
+
+    const RenderPass& pass = frame.passes.back();
+    if (pass.batchCount == 0)
+    {
+        frame.discardPass();
+        return;
+    }
+
+    // Particles move every frame, shaders animate with u_time, and other blend modes do not
+    // compose over a transparent texture: such layers are drawn directly
+    layer.cacheable = !hasEmitter;
+    for (size_t i = pass.firstBatch; layer.cacheable && i < pass.firstBatch + pass.batchCount; ++i)
+    {
+        const RenderBatch& batch = frame.batches[i];
+        layer.cacheable          = !batch.states.shader && batch.states.blendMode == sf::BlendAlpha;
+    }
+    if (!layer.cacheable)
+    {
+        frame.dissolvePass();
+        return;
+    }
+
+    layer.valid = true;
+    ++m_lastLayerRebuilds;
+    appendLayerBlit(layer, frame, view, windowSize);
+}
+
+void SRenderer::appendLayerBlit(const StaticLayer& layer,
+                                RenderFrame&       frame,
+                                const sf::View&    view,
+                                sf::Vector2u       windowSize)
+{
+    // The texture covers the whole view; alpha blending left it premultiplied
+    sf::RenderStates states;
+    states.texture   = &layer.texture->getTexture();
+    states.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+    const sf::Transform& toWorld    = view.getInverseTransform();
+    const sf::FloatRect& viewport   = view.getViewport();
+    const float          left       = viewport.left * static_cast<float>(windowSize.x);
+    const float          top        = viewport.top * static_cast<float>(windowSize.y);
+    const float          right      = (viewport.left + viewport.width) * static_cast<float>(windowSize.x);
+    const float          bottom     = (viewport.top + viewport.height) * static_cast<float>(windowSize.y);
+    const sf::Vector2f   corners[4] = {toWorld.transformPoint(-1.0f, 1.0f),
+                                       toWorld.transformPoint(1.0f, 1.0f),
+                                       toWorld.transformPoint(1.0f, -1.0f),
+                                       toWorld.transformPoint(-1.0f, -1.0f)};
+    const sf::Vector2f   uvs[4]     = {{left, top}, {right, top}, {right, bottom}, {left, bottom}};
+    const int            order[6]   = {0, 1, 2, 0, 2, 3};
+
+    sf::Vertex* out = frame.append(sf::Triangles, states, 6);
+    for (int i = 0; i < 6; ++i)
+    {
+        out[i] = sf::Vertex(corners[order[i]], sf::Color::White, uvs[order[i]]);
+    }
+}
+
+void SRenderer::uploadPendingAssets()
+{
+    if (!m_initialized || !m_window || !m_window->isOpen())
+    {
+        return;
+    }
+
+    // Shaders first drawn since the last call; compiling them is left to here since a submitting frame may be using GL
+    bool loaded = !m_pendingShaders.empty();
+    for (const PendingShader& pending : m_pendingShaders)
+    {
+        m_shaderAssets.set(pending.handle, createShaderUniforms(pending.vertexPath, pending.fragmentPath));
+    }
+    m_pendingShaders.clear();
+
+    // Textures decoded since the last call become visible from the next buildFrame()
+    m_textureStreamer.upload(m_textureUploadBudgetMs,
+                             [this, &loaded](AssetHandle handle, const TextureRegion* region)
+                             {
+                                 m_textureAssets.set(handle, region);
+                                 loaded = true;
+                             });
+
+    // Cached layers may hold entities drawn untextured or unshaded while their asset was loading
+    if (loaded)
+    {
+        invalidateStaticLayers();
+    }
+}
+
+void SRenderer::setParticleSystem(SParticle* particleSystem)
+{
+    m_particleSystem = particleSystem;
+}
+
+RenderStats SRenderer::getStats() const
+{
+    RenderStats stats;
+    stats.queueLength       = m_lastQueueLength;
+    stats.queueChanges      = m_lastQueueChanges;
+    stats.culledRenderables = m_lastCulledRenderables;
+    stats.culledEmitters    = m_lastCulledEmitters;
+    stats.batches           = m_lastBatches;
+    stats.vertices          = m_lastVertices;
+    stats.drawCalls         = m_lastDrawCalls.load(std::memory_order_relaxed);
+    stats.particleVertices  = m_lastParticleVertices;
+    stats.cachedRenderables = m_lastCachedRenderables;
+    stats.layerRebuilds     = m_lastLayerRebuilds;
+    return stats;
+}
+
+bool SRenderer::addStaticLayer(int minZ, int maxZ)
+{
+    if (minZ > maxZ)
+    {
+        spdlog::warn("SRenderer: Static layer {}..{} is empty", minZ, maxZ);
+        return false;
+    }
+
+    // First layer not entirely below the new one; it must also lie entirely above it
+    auto it = std::find_if(m_staticLayers.begin(),
+                           m_staticLayers.end(),
+                           [minZ](const StaticLayer& layer) { return layer.maxZ >= minZ; });
+    if (it != m_staticLayers.end() && it->minZ <= maxZ)
+    {
+        spdlog::warn("SRenderer: Static layer {}..{} overlaps layer {}..{}", minZ, maxZ, it->minZ, it->maxZ);
+        return false;
+    }
+
+    StaticLayer layer;
+    layer.minZ    = minZ;
+    layer.maxZ    = maxZ;
+    layer.texture = std::make_unique<sf::RenderTexture>();
+    layer.dirty   = true;
+    m_staticLayers.insert(it, std::move(layer));
+    return true;
+}
+
+void SRenderer::invalidateStaticLayers()
+{
+    for (StaticLayer& layer : m_staticLayers)
+    {
+        layer.dirty = true;
+    }
+}
+
+bool SRenderer::isInStaticLayer(int zIndex) const
+{
+    for (const StaticLayer& layer : m_staticLayers)
+    {
+        if (zIndex >= layer.minZ && zIndex <= layer.maxZ)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SRenderer::invalidateStaticLayer(int zIndex)
+{
+    for (StaticLayer& layer : m_staticLayers)
+    {
+        if (zIndex >= layer.minZ && zIndex <= layer.maxZ)
+        {
+            layer.dirty = true;
+            return;
+        }
+    }
+}
+
+void SRenderer::clearStaticLayers()
+{
+    m_staticLayers.clear();
+
+    std::lock_guard<std::mutex> lock(m_failedLayerMutex);
+    m_failedLayerTargets.clear();
 }
 
 void SRenderer::clear(const Color& color)
@@ -154,6 +774,8 @@ void SRenderer::clear(const Color& color)
 
 void SRenderer::display()
 {
+    GAMEENGINE_PROFILE_SCOPE("SRenderer::display");
+
     if (m_window && m_window->isOpen())
     {
         m_window->display();
@@ -252,23 +874,95 @@ const sf::Shader* SRenderer::loadShader(const std::string& vertexPath, const std
     return shaderPtr;
 }
 
+void SRenderer::preloadTexture(const std::string& filepath)
+{
+    const AssetHandle handle = AssetHandles::intern(filepath);
+    if (handle == AssetHandles::kInvalid || m_textureAssets.isResolved(handle))
+    {
+        return;
+    }
+
+    m_textureStreamer.request(handle, filepath, m_asyncTextureLoading ? SystemLocator::tryJobs() : nullptr);
+}
+
+const TextureRegion* SRenderer::resolveTexture(AssetHandle handle)
+{
+    if (handle == AssetHandles::kInvalid || m_textureAssets.isResolved(handle))
+    {
+        return m_textureAssets.get(handle);
+    }
+
+    // Only reached until the handle resolves, so the path is not read on steady-state frames
+    const std::string& path = AssetHandles::keyOf(handle);
+
+    // Already in the atlas, e.g. added through getTextureAtlas()
+    if (const TextureRegion* region = m_textureAtlas.find(path))
+    {
+        m_textureAssets.set(handle, region);
+        return region;
+    }
+
+    // Even a synchronous decode leaves the atlas write to uploadPendingAssets(), as a frame may be sampling its pages
+    m_textureStreamer.request(handle, path, m_asyncTextureLoading ? SystemLocator::tryJobs() : nullptr);
+    return nullptr;
+}
+
+ShaderUniforms* SRenderer::resolveShader(const ::Components::CShader& shaderComp)
+{
+    const AssetHandle handle = shaderComp.getShaderHandle();
+    if (handle == AssetHandles::kInvalid || m_shaderAssets.isResolved(handle))
+    {
+        return m_shaderAssets.get(handle);
+    }
+
+    // Compiled by the next uploadPendingAssets(); the entity draws unshaded until then
+    for (const PendingShader& pending : m_pendingShaders)
+    {
+        if (pending.handle == handle)
+        {
+            return nullptr;
+        }
+    }
+    m_pendingShaders.push_back({handle, shaderComp.getVertexShaderPath(), shaderComp.getFragmentShaderPath()});
+    return nullptr;
+}
+
+ShaderUniforms* SRenderer::createShaderUniforms(const std::string& vertexPath, const std::string& fragmentPath)
+{
+    const sf::Shader* shader = loadShader(vertexPath, fragmentPath);
+    if (!shader)
+    {
+        return nullptr;
+    }
+
+    // The cache owns the shader; uniforms are the only state changed through it
+    m_shaderUniforms.push_back(std::make_unique<ShaderUniforms>(const_cast<sf::Shader&>(*shader)));
+    return m_shaderUniforms.back().get();
+}
+
 void SRenderer::clearTextureCache()
 {
+    m_textureStreamer.clear();
     m_textureCache.clear();
+    m_textureAtlas.clear();
+    m_textureAssets.clear();
     spdlog::debug("SRenderer: Texture cache cleared");
 }
 
 void SRenderer::clearShaderCache()
 {
+    m_pendingShaders.clear();
+    m_shaderAssets.clear();
+    m_shaderUniforms.clear();
     m_shaderCache.clear();
     spdlog::debug("SRenderer: Shader cache cleared");
 }
 
-void SRenderer::renderEntity(Entity entity, World& world)
+uint64_t SRenderer::renderEntity(Entity entity, World& world, RenderFrame& frame)
 {
     if (!entity.isValid())
     {
-        return;
+        return 0;
     }
 
     auto components = world.components();
@@ -279,23 +973,24 @@ void SRenderer::renderEntity(Entity entity, World& world)
 
     if (!renderable || !renderable->isVisible())
     {
-        return;
+        return 0;
     }
 
     if (!transform)
     {
-        spdlog::warn("SRenderer: Entity has CRenderable but no CTransform");
-        return;
+        GAMEENGINE_LOG_RATE_LIMITED(LogLevel::Warn,
+                                    "SRenderer: Entity %u has CRenderable but no CTransform",
+                                    static_cast<unsigned>(entity.index));
+        return 0;
     }
 
-    // Get position, scale, and rotation
-    Vec2  pos      = transform->getPosition();
+    // Get position, scale, and rotation (blended between fixed steps for physics-driven transforms)
+    Vec2  pos      = transform->getInterpolatedPosition(m_interpolationAlpha);
     Vec2  scale    = transform->getScale();
-    float rotation = transform->getRotation();
+    float rotation = transform->getInterpolatedRotation(m_interpolationAlpha);
 
     // Convert from physics coordinates (meters, Y-up) to screen coordinates (pixels, Y-down)
-    const float PIXELS_PER_METER = 100.0f;
-    const float SCREEN_HEIGHT    = static_cast<float>(m_window->getSize().y);
+    const float SCREEN_HEIGHT = static_cast<float>(m_window->getSize().y);
 
     sf::Vector2f screenPos;
     screenPos.x = pos.x * PIXELS_PER_METER;
@@ -316,23 +1011,36 @@ void SRenderer::renderEntity(Entity entity, World& world)
         finalColor.a = static_cast<uint8_t>((finalColor.a * material->getOpacity()));
     }
 
-    // Get texture if available (independent of material)
-    const sf::Texture* texture = nullptr;
+    // Get texture if available (independent of material); small images share atlas pages
+    const TextureRegion* texture = nullptr;
     {
         auto* textureComp = components.tryGet<::Components::CTexture>(entity);
         if (textureComp)
         {
-            texture = loadTexture(textureComp->getTexturePath());
+            texture = resolveTexture(textureComp->getTextureHandle());
         }
     }
 
-    // Get shader if available (independent of material)
-    const sf::Shader* shader = nullptr;
+    // Get shader if available (independent of material), with the parameters to upload before drawing
+    ShaderBinding binding;
     {
         auto* shaderComp = components.tryGet<::Components::CShader>(entity);
         if (shaderComp)
         {
-            shader = loadShader(shaderComp->getVertexShaderPath(), shaderComp->getFragmentShaderPath());
+            binding.uniforms = resolveShader(*shaderComp);
+        }
+        if (binding.uniforms && !shaderComp->getParameters().empty())
+        {
+            m_uniformScratch.clear();
+            for (const ::Components::ShaderParameter& parameter : shaderComp->getParameters())
+            {
+                UniformValue& value = m_uniformScratch.emplace_back();
+                value.name          = parameter.nameHandle;
+                value.components    = parameter.components;
+                std::copy(parameter.value, parameter.value + 4, value.value);
+            }
+            binding.values     = m_uniformScratch.data();
+            binding.valueCount = m_uniformScratch.size();
         }
     }
 
@@ -342,66 +1050,55 @@ void SRenderer::renderEntity(Entity entity, World& world)
     {
         states.blendMode = toSFMLBlendMode(material->getBlendMode());
     }
-    if (shader)
+    if (binding.uniforms)
     {
-        states.shader = shader;
-
-        // Set common shader uniforms
-        sf::Shader* mutableShader = const_cast<sf::Shader*>(shader);
-
-        // Time uniform (elapsed time since program start)
-        static sf::Clock shaderClock;
-        float            time = shaderClock.getElapsedTime().asSeconds();
-        mutableShader->setUniform("u_time", time);
+        // Uniforms are uploaded through the binding when the batch is submitted
+        states.shader = binding.uniforms->getShader();
+    }
 
-        // Resolution uniform (screen dimensions)
-        sf::Vector2u windowSize = m_window->getSize();
-        mutableShader->setUniform("u_resolution",
-                                  sf::Vector2f(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y)));
+    // Textured shapes stretch the whole image over their bounds
+    sf::FloatRect textureRect;
+    sf::Vector2f  textureSize;
+    if (texture)
+    {
+        states.texture = texture->texture;
+        textureRect    = texture->rect;
+        textureSize    = sf::Vector2f(textureRect.width, textureRect.height);
     }
 
+    const sf::Color color   = toSFMLColor(finalColor);
+    const float     degrees = -rotation * 180.0f / 3.14159265f;  // Negate for Y-axis flip
+
     // Render based on visual type
+    sf::PrimitiveType        primitive  = sf::Triangles;
     ::Components::VisualType visualType = renderable->getVisualType();
 
     switch (visualType)
     {
         case ::Components::VisualType::Rectangle:
         {
-            sf::RectangleShape rect;
+            sf::Vector2f size(50.0f * scale.x, 50.0f * scale.y);
 
             // If we have a collider, use its size
             auto* collider = components.tryGet<::Components::CCollider2D>(entity);
             if (collider && collider->getShapeType() == ::Components::ColliderShape::Box)
             {
-                float halfWidth  = collider->getBoxHalfWidth() * PIXELS_PER_METER;
-                float halfHeight = collider->getBoxHalfHeight() * PIXELS_PER_METER;
-                rect.setSize(sf::Vector2f(halfWidth * 2.0f, halfHeight * 2.0f));
-                rect.setOrigin(halfWidth, halfHeight);
-            }
-            else
-            {
-                // Default rectangle size
-                rect.setSize(sf::Vector2f(50.0f * scale.x, 50.0f * scale.y));
-                rect.setOrigin(25.0f * scale.x, 25.0f * scale.y);
+                size = sf::Vector2f(collider->getBoxHalfWidth() * 2.0f * PIXELS_PER_METER,
+                                    collider->getBoxHalfHeight() * 2.0f * PIXELS_PER_METER);
             }
 
-            rect.setPosition(screenPos);
-            rect.setRotation(-rotation * 180.0f / 3.14159265f);  // Negate for Y-axis flip
-            rect.setFillColor(toSFMLColor(finalColor));
-
-            if (texture)
+            if (cullDraw(screenPos, std::hypot(size.x, size.y) / 2.0f))
             {
-                rect.setTexture(texture);
+                break;
             }
 
-            m_window->draw(rect, states);
+            const sf::Transform transform = makeTransform(screenPos, degrees, sf::Vector2f(1.0f, 1.0f), size / 2.0f);
+            writeQuad(frame.append(sf::Triangles, states, 6, binding), transform, size, color, textureRect);
             break;
         }
 
         case ::Components::VisualType::Circle:
         {
-            sf::CircleShape circle;
-
             // If we have a collider, use its radius
             auto* collider = components.tryGet<::Components::CCollider2D>(entity);
             float radius   = 25.0f;
@@ -410,19 +1107,18 @@ void SRenderer::renderEntity(Entity entity, World& world)
                 radius = collider->getCircleRadius() * PIXELS_PER_METER;
             }
 
-            circle.setRadius(radius);
-            circle.setOrigin(radius, radius);
-            circle.setPosition(screenPos);
-            circle.setScale(scale.x, scale.y);
-            circle.setRotation(-rotation * 180.0f / 3.14159265f);  // Negate for Y-axis flip
-            circle.setFillColor(toSFMLColor(finalColor));
-
-            if (texture)
+            const float screenRadius = radius * std::max(std::abs(scale.x), std::abs(scale.y));
+            if (cullDraw(screenPos, screenRadius))
             {
-                circle.setTexture(texture);
+                break;
             }
 
-            m_window->draw(circle, states);
+            // Small circles use fewer segments; the outline stays within half a pixel either way
+            const size_t        segments = GeometryTemplates::circleSegments(screenRadius);
+            const sf::Transform transform =
+                makeTransform(screenPos, degrees, sf::Vector2f(scale.x, scale.y), sf::Vector2f(radius, radius));
+            sf::Vertex* out = frame.append(sf::Triangles, states, segments * 3, binding);
+            writeCircle(out, transform, radius, segments, color, textureRect);
             break;
         }
 
@@ -430,8 +1126,7 @@ void SRenderer::renderEntity(Entity entity, World& world)
         {
             if (texture)
             {
-                sf::Sprite    sprite(*texture);
-                sf::FloatRect bounds = sprite.getLocalBounds();
+                sf::Vector2f spriteScale(scale.x, scale.y);
 
                 // Scale sprite to match physics collider size
                 auto* collider = components.tryGet<::Components::CCollider2D>(entity);
@@ -463,36 +1158,32 @@ void SRenderer::renderEntity(Entity entity, World& world)
                     {
                         // Calculate scale to fit target size
                         // Use the smaller dimension to ensure sprite fills the collider
-                        float spriteSize  = std::min(bounds.width, bounds.height);
-                        float spriteScale = targetSize / spriteSize;
-                        sprite.setScale(spriteScale * scale.x, spriteScale * scale.y);
-                    }
-                    else
-                    {
-                        sprite.setScale(scale.x, scale.y);
+                        float spriteSize = std::min(textureSize.x, textureSize.y);
+                        spriteScale *= targetSize / spriteSize;
                     }
                 }
-                else
+
+                const sf::Vector2f spriteSize(textureSize.x * spriteScale.x, textureSize.y * spriteScale.y);
+                if (cullDraw(screenPos, std::hypot(spriteSize.x, spriteSize.y) / 2.0f))
                 {
-                    sprite.setScale(scale.x, scale.y);
+                    break;
                 }
 
-                sprite.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
-                sprite.setPosition(screenPos);
-                sprite.setRotation(-rotation * 180.0f / 3.14159265f);  // Negate for Y-axis flip
-                sprite.setColor(toSFMLColor(finalColor));
-
-                m_window->draw(sprite, states);
+                const sf::Transform transform = makeTransform(screenPos, degrees, spriteScale, textureSize / 2.0f);
+                writeQuad(frame.append(sf::Triangles, states, 6, binding), transform, textureSize, color, textureRect);
             }
             else
             {
                 // Fallback: draw a rectangle if no texture
-                sf::RectangleShape rect(sf::Vector2f(50.0f * scale.x, 50.0f * scale.y));
-                rect.setOrigin(25.0f * scale.x, 25.0f * scale.y);
-                rect.setPosition(screenPos);
-                rect.setRotation(-rotation * 180.0f / 3.14159265f);  // Negate for Y-axis flip
-                rect.setFillColor(toSFMLColor(finalColor));
-                m_window->draw(rect, states);
+                const sf::Vector2f size(50.0f * scale.x, 50.0f * scale.y);
+                if (cullDraw(screenPos, std::hypot(size.x, size.y) / 2.0f))
+                {
+                    break;
+                }
+
+                const sf::Transform transform =
+                    makeTransform(screenPos, degrees, sf::Vector2f(1.0f, 1.0f), size / 2.0f);
+                writeQuad(frame.append(sf::Triangles, states, 6, binding), transform, size, color, sf::FloatRect());
             }
             break;
         }
@@ -524,41 +1215,28 @@ void SRenderer::renderEntity(Entity entity, World& world)
             screenEnd.x = screenPos.x + (rotatedEnd.x * PIXELS_PER_METER * scale.x);
             screenEnd.y = screenPos.y - (rotatedEnd.y * PIXELS_PER_METER * scale.y);  // Negative for Y-flip
 
-            // Create line using VertexArray
-            float           thickness = renderable->getLineThickness();
-            sf::Color       lineColor = toSFMLColor(finalColor);
-            sf::VertexArray line(sf::Lines, 2);
-            line[0].position = screenStart;
-            line[0].color    = lineColor;
-            line[1].position = screenEnd;
-            line[1].color    = lineColor;
+            // Lines are never textured
+            states.texture  = nullptr;
+            float thickness = renderable->getLineThickness();
 
-            // Draw the line (for thickness > 1, draw multiple times with offset)
+            const sf::Vector2f halfSpan = (screenEnd - screenStart) / 2.0f;
+            if (cullDraw(screenStart + halfSpan, std::hypot(halfSpan.x, halfSpan.y) + thickness / 2.0f))
+            {
+                break;
+            }
+
+            // Hairlines stay GL lines; thicker lines are one quad that batches with other triangles
             if (thickness <= 1.0f)
             {
-                m_window->draw(line, states);
+                primitive        = sf::Lines;
+                sf::Vertex* line = frame.append(sf::Lines, states, 2, binding);
+                line[0]          = sf::Vertex(screenStart, color);
+                line[1]          = sf::Vertex(screenEnd, color);
             }
-            else
+            else if (screenStart != screenEnd)
             {
-                // Calculate perpendicular offset for thickness
-                sf::Vector2f direction = screenEnd - screenStart;
-                float        length    = std::sqrt(direction.x * direction.x + direction.y * direction.y);
-                if (length > 0.0f)
-                {
-                    sf::Vector2f perpendicular(-direction.y / length, direction.x / length);
-
-                    // Draw multiple lines with offset to simulate thickness
-                    int halfThickness = static_cast<int>(thickness / 2.0f);
-                    for (int offset = -halfThickness; offset <= halfThickness; ++offset)
-                    {
-                        sf::VertexArray thickLine(sf::Lines, 2);
-                        thickLine[0].position = screenStart + perpendicular * static_cast<float>(offset);
-                        thickLine[0].color    = lineColor;
-                        thickLine[1].position = screenEnd + perpendicular * static_cast<float>(offset);
-                        thickLine[1].color    = lineColor;
-                        m_window->draw(thickLine, states);
-                    }
-                }
+                sf::Vertex* quad = frame.append(sf::Triangles, states, GeometryTemplates::kLineQuadVertices, binding);
+                GeometryTemplates::writeThickLine(quad, screenStart, screenEnd, thickness, color);
             }
             break;
         }
@@ -567,8 +1245,39 @@ void SRenderer::renderEntity(Entity entity, World& world)
         case ::Components::VisualType::None:
         default:
             // No rendering for None or Custom (Custom would use shaders)
-            break;
+            return 0;
+    }
+
+    return batchKeyOf(primitive, states, binding);
+}
+
+bool SRenderer::cullDraw(sf::Vector2f center, float radius)
+{
+    const sf::Vector2f extent(radius, radius);
+    if (outsideView(m_viewBounds, center - extent, center + extent))
+    {
+        ++m_lastCulledRenderables;
+        return true;
+    }
+    return false;
+}
+
+bool SRenderer::cullEmitter(Entity entity, World& world)
+{
+    // The particle system places the quads, so it also knows the scale their box is converted with
+    sf::Vector2f screenMin;
+    sf::Vector2f screenMax;
+    if (!m_particleSystem || !m_particleSystem->getEmitterScreenBounds(entity, world, screenMin, screenMax))
+    {
+        return false;
+    }
+
+    if (outsideView(m_viewBounds, screenMin, screenMax))
+    {
+        ++m_lastCulledEmitters;
+        return true;
     }
+    return false;
 }
 
 sf::BlendMode SRenderer::toSFMLBlendMode(::Components::BlendMode blendMode) const
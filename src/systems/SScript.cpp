@@ -3,13 +3,14 @@
 #include <CNativeScript.h>
 #include <World.h>
 
+#include <memory_resource>
 #include <vector>
 
 void Systems::SScript::update(float deltaTime, World& world)
 {
     // Snapshot entities first so scripts can safely spawn entities / add scripts
     // without invalidating the underlying component store iteration.
-    std::vector<Entity> scriptedEntities;
+    std::pmr::vector<Entity> scriptedEntities(world.frameMemory());
     scriptedEntities.reserve(64);
 
     world.components().view<Components::CNativeScript>([&](Entity entity, Components::CNativeScript& /*script*/)
@@ -35,18 +36,36 @@ void Systems::SScript::update(float deltaTime, World& world)
         {
             script->instance->onCreate(entity, world);
             script->created = true;
+            script->bucket  = m_nextBucket++;
 
-            // Re-fetch script pointer after onCreate because the component store may have
-            // reallocated if new scripts were added during onCreate (e.g., spawning entities)
-            script = world.components().tryGet<Components::CNativeScript>(entity);
-            if (!script || !script->instance)
+            // CNativeScript storage is pointer-stable, so scripts spawned during onCreate cannot move
+            // this component. It only changes if onCreate destroyed the entity or removed/replaced its script.
+            if (!world.isAlive(entity) || world.components().tryGet<Components::CNativeScript>(entity) != script
+                || !script->instance)
             {
                 entityIndex++;
                 continue;
             }
         }
 
-        script->instance->onUpdate(deltaTime, entity, world);
+        script->pendingTime += deltaTime;
+        if (script->updateInterval > 1 && (m_frame + script->bucket) % script->updateInterval != 0)
+        {
+            entityIndex++;
+            continue;
+        }
+
+        const float elapsed = script->pendingTime;
+        script->pendingTime = 0.0f;
+        script->instance->onUpdate(elapsed, entity, world);
         entityIndex++;
     }
+
+    m_frame++;
+}
+
+void Systems::SScript::declareAccess(SystemAccess& access) const
+{
+    // Scripts run arbitrary gameplay code against the whole world
+    access.exclusive().mainThread();
 }
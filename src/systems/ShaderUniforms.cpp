@@ -0,0 +1,80 @@
+#include "ShaderUniforms.h"
+
+#include <algorithm>
+
+namespace Systems
+{
+
+bool UniformValue::operator==(const UniformValue& other) const
+{
+    return name == other.name && components == other.components
+           && std::equal(value, value + components, other.value);
+}
+
+void ShaderUniforms::applyFrame(float time, sf::Vector2f resolution)
+{
+    if (!m_hasFrameUniforms || time != m_time)
+    {
+        m_shader.setUniform("u_time", time);
+        m_time = time;
+        ++m_uploadCount;
+    }
+    if (!m_hasFrameUniforms || resolution != m_resolution)
+    {
+        m_shader.setUniform("u_resolution", resolution);
+        m_resolution = resolution;
+        ++m_uploadCount;
+    }
+    m_hasFrameUniforms = true;
+}
+
+void ShaderUniforms::apply(const UniformValue* values, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const UniformValue& value = values[i];
+
+        auto it = std::find_if(m_uploaded.begin(),
+                               m_uploaded.end(),
+                               [&value](const Uploaded& uploaded) { return uploaded.value.name == value.name; });
+        if (it == m_uploaded.end())
+        {
+            const std::string& name = AssetHandles::keyOf(value.name);
+            if (name.empty())
+            {
+                continue;
+            }
+            it = m_uploaded.insert(m_uploaded.end(), Uploaded{&name, UniformValue()});
+        }
+        else if (it->value == value)
+        {
+            continue;
+        }
+
+        upload(*it->name, value);
+        it->value = value;
+    }
+}
+
+void ShaderUniforms::upload(const std::string& name, const UniformValue& value)
+{
+    const float* v = value.value;
+    switch (value.components)
+    {
+        case 1:
+            m_shader.setUniform(name, v[0]);
+            break;
+        case 2:
+            m_shader.setUniform(name, sf::Glsl::Vec2(v[0], v[1]));
+            break;
+        case 3:
+            m_shader.setUniform(name, sf::Glsl::Vec3(v[0], v[1], v[2]));
+            break;
+        default:
+            m_shader.setUniform(name, sf::Glsl::Vec4(v[0], v[1], v[2], v[3]));
+            break;
+    }
+    ++m_uploadCount;
+}
+
+}  // namespace Systems
@@ -1,5 +1,6 @@
 #include "SystemLocator.h"
 
+#include "JobSystem.h"
 #include "S2DPhysics.h"
 #include "SAudio.h"
 #include "SInput.h"
@@ -16,6 +17,7 @@ S2DPhysics* g_physics  = nullptr;
 SRenderer*  g_renderer = nullptr;
 SParticle*  g_particle = nullptr;
 SAudio*     g_audio    = nullptr;
+JobSystem*  g_jobs     = nullptr;
 }  // namespace
 
 void SystemLocator::provideInput(SInput* input)
@@ -43,6 +45,11 @@ void SystemLocator::provideAudio(SAudio* audio)
     g_audio = audio;
 }
 
+void SystemLocator::provideJobs(JobSystem* jobs)
+{
+    g_jobs = jobs;
+}
+
 SInput& SystemLocator::input()
 {
     assert(g_input && "Input system not set");
@@ -73,6 +80,12 @@ SAudio& SystemLocator::audio()
     return *g_audio;
 }
 
+JobSystem& SystemLocator::jobs()
+{
+    assert(g_jobs && "Job system not set");
+    return *g_jobs;
+}
+
 SInput* SystemLocator::tryInput()
 {
     return g_input;
@@ -98,4 +111,9 @@ SAudio* SystemLocator::tryAudio()
     return g_audio;
 }
 
+JobSystem* SystemLocator::tryJobs()
+{
+    return g_jobs;
+}
+
 }  // namespace Systems
@@ -0,0 +1,194 @@
+#include "SystemScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "JobSystem.h"
+
+namespace Systems
+{
+
+void SystemScheduler::addSystem(ISystem* system)
+{
+    if (!system || std::find(m_systems.begin(), m_systems.end(), system) != m_systems.end())
+    {
+        return;
+    }
+    m_systems.push_back(system);
+    m_dirty = true;
+}
+
+bool SystemScheduler::removeSystem(ISystem* system)
+{
+    auto it = std::find(m_systems.begin(), m_systems.end(), system);
+    if (it == m_systems.end())
+    {
+        return false;
+    }
+    m_systems.erase(it);
+    m_dirty = true;
+    return true;
+}
+
+std::vector<size_t> SystemScheduler::getDependencies(const ISystem* system)
+{
+    if (m_dirty)
+    {
+        rebuild();
+    }
+
+    for (const StageGraph* graph : {&m_preFlush, &m_postFlush})
+    {
+        for (const auto& node : graph->nodes)
+        {
+            if (node.system == system)
+            {
+                return node.dependencies;
+            }
+        }
+    }
+    return {};
+}
+
+SystemScheduler::StageGraph& SystemScheduler::graphFor(UpdateStage stage)
+{
+    return stage == UpdateStage::PreFlush ? m_preFlush : m_postFlush;
+}
+
+void SystemScheduler::rebuild()
+{
+    m_preFlush  = StageGraph{};
+    m_postFlush = StageGraph{};
+
+    for (ISystem* system : m_systems)
+    {
+        Node node;
+        node.system = system;
+        system->declareAccess(node.access);
+        graphFor(system->stage()).nodes.push_back(std::move(node));
+    }
+
+    for (StageGraph* graph : {&m_preFlush, &m_postFlush})
+    {
+        auto&        nodes = graph->nodes;
+        const size_t count = nodes.size();
+
+        // reachable[i][j]: node j is (transitively) ordered after node i
+        std::vector<std::vector<bool>> reachable(count, std::vector<bool>(count, false));
+
+        for (size_t later = 0; later < count; ++later)
+        {
+            for (size_t earlier = 0; earlier < later; ++earlier)
+            {
+                if (!nodes[earlier].access.conflictsWith(nodes[later].access))
+                {
+                    continue;
+                }
+
+                nodes[later].dependencies.push_back(earlier);
+                nodes[earlier].successors.push_back(later);
+                ++nodes[later].predecessors;
+
+                reachable[earlier][later] = true;
+                for (size_t i = 0; i < earlier; ++i)
+                {
+                    if (reachable[i][earlier])
+                    {
+                        reachable[i][later] = true;
+                    }
+                }
+            }
+        }
+
+        graph->parallel = false;
+        for (size_t later = 1; later < count && !graph->parallel; ++later)
+        {
+            for (size_t earlier = 0; earlier < later; ++earlier)
+            {
+                const bool bothMainThread =
+                    nodes[earlier].access.requiresMainThread() && nodes[later].access.requiresMainThread();
+                if (!reachable[earlier][later] && !bothMainThread)
+                {
+                    graph->parallel = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    m_dirty = false;
+}
+
+void SystemScheduler::runStage(UpdateStage stage, JobSystem* jobs, const RunFn& run)
+{
+    if (m_dirty)
+    {
+        rebuild();
+    }
+
+    StageGraph& graph = graphFor(stage);
+    if (graph.nodes.empty())
+    {
+        return;
+    }
+
+    // Registration order is a valid topological order of the graph
+    if (!jobs || jobs->getWorkerCount() == 0 || !graph.parallel)
+    {
+        for (auto& node : graph.nodes)
+        {
+            run(*node.system);
+        }
+        return;
+    }
+
+    const size_t                           count = graph.nodes.size();
+    std::unique_ptr<std::atomic<size_t>[]> remaining(new std::atomic<size_t>[count]);
+    JobCounter                             stageCounter;
+    std::function<void(size_t)>            launch;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        remaining[i].store(graph.nodes[i].predecessors, std::memory_order_relaxed);
+    }
+
+    launch = [&](size_t index)
+    {
+        Node& node = graph.nodes[index];
+        auto  job  = [&, index]()
+        {
+            run(*graph.nodes[index].system);
+
+            // Successors are scheduled before this job finishes, so stageCounter cannot drain early
+            for (size_t successor : graph.nodes[index].successors)
+            {
+                if (remaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    launch(successor);
+                }
+            }
+        };
+
+        if (node.access.requiresMainThread())
+        {
+            jobs->scheduleMainThread(std::move(job), &stageCounter);
+        }
+        else
+        {
+            jobs->schedule(std::move(job), &stageCounter);
+        }
+    };
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (graph.nodes[i].predecessors == 0)
+        {
+            launch(i);
+        }
+    }
+
+    jobs->wait(stageCounter);
+}
+
+}  // namespace Systems
@@ -0,0 +1,244 @@
+#include "TextureAtlas.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <limits>
+
+namespace Systems
+{
+
+SkylinePacker::SkylinePacker(unsigned width, unsigned height) : m_width(width), m_height(height)
+{
+    m_skyline.push_back({0, 0, width});
+}
+
+bool SkylinePacker::pack(unsigned width, unsigned height, unsigned& x, unsigned& y)
+{
+    size_t   bestIndex = m_skyline.size();
+    unsigned bestY     = std::numeric_limits<unsigned>::max();
+    unsigned bestWidth = std::numeric_limits<unsigned>::max();
+
+    for (size_t i = 0; i < m_skyline.size(); ++i)
+    {
+        unsigned top;
+        if (!fits(i, width, height, top))
+        {
+            continue;
+        }
+
+        // Lowest top edge wins; on a tie, the narrower segment wastes less
+        if (top < bestY || (top == bestY && m_skyline[i].width < bestWidth))
+        {
+            bestIndex = i;
+            bestY     = top;
+            bestWidth = m_skyline[i].width;
+        }
+    }
+
+    if (bestIndex == m_skyline.size())
+    {
+        return false;
+    }
+
+    x = m_skyline[bestIndex].x;
+    y = bestY;
+    addSegment(bestIndex, x, y + height, width);
+    m_usedArea += static_cast<uint64_t>(width) * height;
+    return true;
+}
+
+float SkylinePacker::getOccupancy() const
+{
+    return static_cast<float>(static_cast<double>(m_usedArea) / (static_cast<double>(m_width) * m_height));
+}
+
+bool SkylinePacker::fits(size_t index, unsigned width, unsigned height, unsigned& y) const
+{
+    if (m_skyline[index].x + width > m_width)
+    {
+        return false;
+    }
+
+    // The rectangle rests on the highest segment it spans
+    y                  = 0;
+    unsigned remaining = width;
+    for (size_t i = index; remaining > 0 && i < m_skyline.size(); ++i)
+    {
+        y = std::max(y, m_skyline[i].y);
+        if (y + height > m_height)
+        {
+            return false;
+        }
+        remaining -= std::min(remaining, m_skyline[i].width);
+    }
+    return true;
+}
+
+void SkylinePacker::addSegment(size_t index, unsigned x, unsigned y, unsigned width)
+{
+    m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(index), Segment{x, y, width});
+
+    // Cut away the parts of the following segments now covered by the new one
+    for (size_t i = index + 1; i < m_skyline.size();)
+    {
+        const Segment& previous    = m_skyline[i - 1];
+        const unsigned previousEnd = previous.x + previous.width;
+        Segment&       segment     = m_skyline[i];
+        if (segment.x >= previousEnd)
+        {
+            break;
+        }
+
+        const unsigned overlap = previousEnd - segment.x;
+        if (segment.width <= overlap)
+        {
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+        segment.x += overlap;
+        segment.width -= overlap;
+        break;
+    }
+
+    // Neighbours at the same height become one segment
+    for (size_t i = 0; i + 1 < m_skyline.size();)
+    {
+        if (m_skyline[i].y == m_skyline[i + 1].y)
+        {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+TextureAtlas::TextureAtlas(unsigned pageSize, unsigned maxPackedSize, unsigned padding)
+    : m_pageSize(pageSize), m_maxPackedSize(std::min(maxPackedSize, pageSize)), m_padding(padding)
+{
+}
+
+const TextureRegion* TextureAtlas::load(const std::string& path)
+{
+    if (path.empty())
+    {
+        return nullptr;
+    }
+
+    if (const TextureRegion* region = find(path))
+    {
+        return region;
+    }
+
+    if (m_failedPaths.count(path) != 0)
+    {
+        return nullptr;
+    }
+
+    sf::Image image;
+    if (!image.loadFromFile(path))
+    {
+        spdlog::error("TextureAtlas: Failed to load texture from '{}'", path);
+        m_failedPaths.insert(path);
+        return nullptr;
+    }
+
+    const TextureRegion* region = add(path, image);
+    if (!region)
+    {
+        m_failedPaths.insert(path);
+        return nullptr;
+    }
+    spdlog::debug("TextureAtlas: Loaded texture '{}'", path);
+    return region;
+}
+
+const TextureRegion* TextureAtlas::add(const std::string& key, const sf::Image& image)
+{
+    if (const TextureRegion* existing = find(key))
+    {
+        return existing;
+    }
+
+    const sf::Vector2u size = image.getSize();
+    if (size.x == 0 || size.y == 0)
+    {
+        return nullptr;
+    }
+
+    TextureRegion region;
+    if (size.x > m_maxPackedSize || size.y > m_maxPackedSize || !pack(image, region))
+    {
+        auto texture = std::make_unique<sf::Texture>();
+        if (!texture->loadFromImage(image))
+        {
+            spdlog::error("TextureAtlas: Failed to create a {}x{} texture for '{}'", size.x, size.y, key);
+            return nullptr;
+        }
+        region.texture = texture.get();
+        region.rect    = sf::FloatRect(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(size));
+        m_standalone.push_back(std::move(texture));
+    }
+
+    return &m_regions.emplace(key, region).first->second;
+}
+
+const TextureRegion* TextureAtlas::find(const std::string& key) const
+{
+    auto it = m_regions.find(key);
+    return it != m_regions.end() ? &it->second : nullptr;
+}
+
+void TextureAtlas::clear()
+{
+    m_regions.clear();
+    m_failedPaths.clear();
+    m_standalone.clear();
+    m_pages.clear();
+}
+
+bool TextureAtlas::pack(const sf::Image& image, TextureRegion& region)
+{
+    const sf::Vector2u size = image.getSize();
+
+    unsigned x      = 0;
+    unsigned y      = 0;
+    Page*    target = nullptr;
+    for (Page& page : m_pages)
+    {
+        if (page.packer.pack(size.x + m_padding, size.y + m_padding, x, y))
+        {
+            target = &page;
+            break;
+        }
+    }
+
+    if (!target)
+    {
+        const unsigned side    = std::min(m_pageSize, sf::Texture::getMaximumSize());
+        auto           texture = std::make_unique<sf::Texture>();
+        if (side < size.x + m_padding || side < size.y + m_padding || !texture->create(side, side))
+        {
+            return false;
+        }
+
+        // Start from transparent pixels so filtering at region edges never picks up garbage
+        sf::Image blank;
+        blank.create(side, side, sf::Color::Transparent);
+        texture->update(blank);
+
+        m_pages.push_back({std::move(texture), SkylinePacker(side, side)});
+        target = &m_pages.back();
+        target->packer.pack(size.x + m_padding, size.y + m_padding, x, y);
+        spdlog::debug("TextureAtlas: Opened page {} ({}x{})", m_pages.size(), side, side);
+    }
+
+    target->texture->update(image, x, y);
+    region.texture = target->texture.get();
+    region.rect    = sf::FloatRect(sf::Vector2f(sf::Vector2u(x, y)), sf::Vector2f(size));
+    return true;
+}
+
+}  // namespace Systems
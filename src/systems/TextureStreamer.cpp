@@ -0,0 +1,103 @@
+#include "TextureStreamer.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace Systems
+{
+
+TextureStreamer::TextureStreamer(TextureAtlas& atlas) : m_atlas(atlas) {}
+
+TextureStreamer::~TextureStreamer()
+{
+    clear();
+}
+
+bool TextureStreamer::request(AssetHandle handle, const std::string& path, JobSystem* jobs)
+{
+    if (handle == AssetHandles::kInvalid || path.empty())
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (std::find(m_requested.begin(), m_requested.end(), handle) != m_requested.end())
+        {
+            return false;
+        }
+        m_requested.push_back(handle);
+    }
+
+    if (jobs && jobs->getWorkerCount() > 0)
+    {
+        m_decodeJobs = jobs;
+        jobs->schedule([this, handle, path]() { decode(handle, path); }, &m_inFlight);
+    }
+    else
+    {
+        decode(handle, path);
+    }
+    return true;
+}
+
+size_t TextureStreamer::getPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_requested.size();
+}
+
+void TextureStreamer::clear()
+{
+    if (m_decodeJobs)
+    {
+        m_decodeJobs->wait(m_inFlight);
+        m_decodeJobs = nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_decoded.clear();
+    m_requested.clear();
+    m_uploading.clear();
+    m_uploadPosition = 0;
+}
+
+void TextureStreamer::decode(AssetHandle handle, const std::string& path)
+{
+    Decoded decoded;
+    decoded.handle = handle;
+    decoded.path   = path;
+    decoded.image  = std::make_unique<sf::Image>();
+    if (!decoded.image->loadFromFile(path))
+    {
+        spdlog::error("TextureStreamer: Failed to load texture from '{}'", path);
+        decoded.image.reset();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_decoded.push_back(std::move(decoded));
+}
+
+void TextureStreamer::takeDecoded()
+{
+    m_uploading.clear();
+    m_uploadPosition = 0;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_uploading.swap(m_decoded);
+}
+
+const TextureRegion* TextureStreamer::uploadOne(const Decoded& decoded)
+{
+    const TextureRegion* region = decoded.image ? m_atlas.add(decoded.path, *decoded.image) : nullptr;
+    if (region)
+    {
+        spdlog::debug("TextureStreamer: Uploaded texture '{}'", decoded.path);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_requested.erase(std::remove(m_requested.begin(), m_requested.end(), decoded.handle), m_requested.end());
+    return region;
+}
+
+}  // namespace Systems
@@ -0,0 +1,60 @@
+#include "AssetHandle.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+struct HandleTable
+{
+    std::mutex                                   mutex;
+    std::unordered_map<std::string, AssetHandle> handles;
+    std::vector<const std::string*>              keys;  ///< By handle - 1; map nodes never move
+};
+
+HandleTable& table()
+{
+    static HandleTable handleTable;
+    return handleTable;
+}
+}  // namespace
+
+AssetHandle AssetHandles::intern(const std::string& key)
+{
+    if (key.empty())
+    {
+        return kInvalid;
+    }
+
+    HandleTable&                table = ::table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    // Handles start at 1 so that 0 can mean "no asset"
+    auto [it, inserted] = table.handles.try_emplace(key, static_cast<AssetHandle>(table.handles.size() + 1));
+    if (inserted)
+    {
+        table.keys.push_back(&it->first);
+    }
+    return it->second;
+}
+
+const std::string& AssetHandles::keyOf(AssetHandle handle)
+{
+    static const std::string empty;
+
+    HandleTable&                table = ::table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    if (handle == kInvalid || handle > table.keys.size())
+    {
+        return empty;
+    }
+    return *table.keys[handle - 1];
+}
+
+size_t AssetHandles::count()
+{
+    HandleTable&                table = ::table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.handles.size();
+}
@@ -0,0 +1,37 @@
+#include "EngineStats.h"
+
+StatCounter& StatCounters::counter(const std::string& name, StatCounterKind kind)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (StatCounter& existing : m_counters)
+    {
+        if (existing.m_name == name)
+        {
+            return existing;
+        }
+    }
+
+    return m_counters.emplace_back(name, kind);
+}
+
+void StatCounters::snapshot(std::vector<StatCounterValue>& out)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    out.resize(m_counters.size());
+    for (size_t i = 0; i < m_counters.size(); ++i)
+    {
+        StatCounter& counter = m_counters[i];
+        out[i].name          = counter.m_name;
+        out[i].value         = counter.m_kind == StatCounterKind::PerFrame
+                                   ? counter.m_value.exchange(0, std::memory_order_relaxed)
+                                   : counter.m_value.load(std::memory_order_relaxed);
+    }
+}
+
+size_t StatCounters::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_counters.size();
+}
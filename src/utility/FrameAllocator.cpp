@@ -0,0 +1,111 @@
+#include "FrameAllocator.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+constexpr size_t kBlockAlignment = alignof(std::max_align_t);
+}  // namespace
+
+FrameAllocator::FrameAllocator(size_t initialCapacity, std::pmr::memory_resource* upstream)
+    : m_upstream(upstream ? upstream : std::pmr::new_delete_resource()), m_capacity(initialCapacity)
+{
+    if (m_capacity > 0)
+    {
+        m_block = static_cast<std::byte*>(m_upstream->allocate(m_capacity, kBlockAlignment));
+    }
+}
+
+FrameAllocator::~FrameAllocator()
+{
+    releaseOverflow();
+    if (m_block)
+    {
+        m_upstream->deallocate(m_block, m_capacity, kBlockAlignment);
+    }
+}
+
+void FrameAllocator::reset()
+{
+    const size_t used = getBytesUsed();
+    m_highWaterMark   = std::max(m_highWaterMark, used);
+
+    if (!m_overflow.empty())
+    {
+        releaseOverflow();
+
+        // Grow once so the same workload fits next frame without touching upstream
+        const size_t newCapacity = std::max(m_capacity * 2, used);
+        if (m_block)
+        {
+            m_upstream->deallocate(m_block, m_capacity, kBlockAlignment);
+        }
+        m_block    = static_cast<std::byte*>(m_upstream->allocate(newCapacity, kBlockAlignment));
+        m_capacity = newCapacity;
+    }
+
+    m_offset.store(0, std::memory_order_relaxed);
+}
+
+size_t FrameAllocator::getBytesUsed() const
+{
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    return std::min(m_offset.load(std::memory_order_relaxed), m_capacity) + m_overflowBytes;
+}
+
+size_t FrameAllocator::getOverflowCount() const
+{
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    return m_overflow.size();
+}
+
+void* FrameAllocator::do_allocate(size_t bytes, size_t alignment)
+{
+    const uintptr_t base   = reinterpret_cast<uintptr_t>(m_block);
+    size_t          offset = m_offset.load(std::memory_order_relaxed);
+
+    while (m_block)
+    {
+        const uintptr_t aligned = (base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        const size_t    begin   = static_cast<size_t>(aligned - base);
+        if (begin + bytes > m_capacity)
+        {
+            break;
+        }
+        if (m_offset.compare_exchange_weak(offset, begin + bytes, std::memory_order_relaxed))
+        {
+            return m_block + begin;
+        }
+    }
+
+    void*                       pointer = m_upstream->allocate(bytes, alignment);
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    m_overflow.push_back({pointer, bytes, alignment});
+    m_overflowBytes += bytes + alignment;
+    return pointer;
+}
+
+void FrameAllocator::do_deallocate(void* pointer, size_t bytes, size_t alignment)
+{
+    // Released in bulk by reset()
+    (void)pointer;
+    (void)bytes;
+    (void)alignment;
+}
+
+bool FrameAllocator::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+void FrameAllocator::releaseOverflow()
+{
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    for (const Overflow& overflow : m_overflow)
+    {
+        m_upstream->deallocate(overflow.pointer, overflow.bytes, overflow.alignment);
+    }
+    m_overflow.clear();
+    m_overflowBytes = 0;
+}
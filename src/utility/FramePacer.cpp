@@ -0,0 +1,128 @@
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "Profiler.h"
+
+namespace
+{
+constexpr float kMinDeltaSeconds = 0.001f;        // Guards against zero-length frames
+constexpr float kMaxDeltaSeconds = 0.25f;         // Stalls (breakpoints, window drags) never become huge steps
+constexpr float kDefaultDelta    = 1.0f / 60.0f;  // First frame when no target rate is set
+
+FramePacer::Clock::duration toDuration(double seconds)
+{
+    return std::chrono::duration_cast<FramePacer::Clock::duration>(std::chrono::duration<double>(seconds));
+}
+
+float toSeconds(FramePacer::Clock::duration duration)
+{
+    return std::chrono::duration<float>(duration).count();
+}
+}  // namespace
+
+FramePacer::FramePacer(double targetFrameRate, double spinThresholdSeconds)
+{
+    setTargetFrameRate(targetFrameRate);
+    setSpinThreshold(spinThresholdSeconds);
+}
+
+void FramePacer::setTargetFrameRate(double framesPerSecond)
+{
+    m_targetFrameRate = framesPerSecond > 0.0 ? framesPerSecond : 0.0;
+    m_period          = m_targetFrameRate > 0.0 ? toDuration(1.0 / m_targetFrameRate) : Clock::duration::zero();
+    m_started         = false;
+}
+
+void FramePacer::setSpinThreshold(double seconds)
+{
+    m_spinThreshold = toDuration(std::max(0.0, seconds));
+}
+
+float FramePacer::waitForNextFrame()
+{
+    GAMEENGINE_PROFILE_SCOPE("FramePacer::waitForNextFrame");
+
+    Clock::time_point start = Clock::now();
+    float             delta = 0.0f;
+
+    if (!m_started)
+    {
+        // Nothing to measure against yet: assume one nominal frame
+        m_started  = true;
+        delta      = m_period > Clock::duration::zero() ? toSeconds(m_period) : kDefaultDelta;
+        m_deadline = start + m_period;
+    }
+    else
+    {
+        if (m_period > Clock::duration::zero())
+        {
+            if (start <= m_deadline)
+            {
+                waitUntil(m_deadline);
+                start      = Clock::now();
+                m_deadline += m_period;
+            }
+            else
+            {
+                m_missedDeadlines++;
+                m_deadline = start + m_period;
+            }
+        }
+        delta = toSeconds(start - m_frameStart);
+    }
+
+    m_frameStart = start;
+    m_rawDelta   = delta;
+    m_frameCount++;
+
+    m_history[m_historyNext] = std::clamp(delta, kMinDeltaSeconds, kMaxDeltaSeconds);
+    m_historyNext            = (m_historyNext + 1) % kSmoothingFrames;
+    m_historySize            = std::min(m_historySize + 1, kSmoothingFrames);
+
+    float sum = 0.0f;
+    for (size_t i = 0; i < m_historySize; ++i)
+    {
+        sum += m_history[i];
+    }
+    m_smoothedDelta = sum / static_cast<float>(m_historySize);
+    return m_smoothedDelta;
+}
+
+void FramePacer::reset()
+{
+    m_started         = false;
+    m_sleepOvershoot  = Clock::duration::zero();
+    m_history         = {};
+    m_historySize     = 0;
+    m_historyNext     = 0;
+    m_rawDelta        = 0.0f;
+    m_smoothedDelta   = 0.0f;
+    m_missedDeadlines = 0;
+    m_frameCount      = 0;
+}
+
+void FramePacer::waitUntil(Clock::time_point deadline)
+{
+    const Clock::duration spinWindow = std::min(m_spinThreshold + m_sleepOvershoot, m_period);
+
+    const Clock::time_point sleepStart = Clock::now();
+    if (deadline - sleepStart > spinWindow)
+    {
+        const Clock::duration request = deadline - sleepStart - spinWindow;
+        std::this_thread::sleep_for(request);
+
+        // Track how far the OS oversleeps so later frames start spinning early enough; the estimate
+        // decays slowly so one preempted sleep does not turn every following frame into a busy wait
+        const Clock::duration overshoot = Clock::now() - sleepStart - request;
+        m_sleepOvershoot                = overshoot > m_sleepOvershoot
+                                              ? overshoot
+                                              : m_sleepOvershoot - (m_sleepOvershoot - overshoot) / 16;
+    }
+
+    while (Clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
@@ -0,0 +1,95 @@
+#include "Log.h"
+
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+
+namespace
+{
+spdlog::level::level_enum toSpdlog(LogLevel level)
+{
+    switch (level)
+    {
+        case LogLevel::Debug:
+            return spdlog::level::debug;
+        case LogLevel::Info:
+            return spdlog::level::info;
+        case LogLevel::Warn:
+            return spdlog::level::warn;
+        case LogLevel::Error:
+        default:
+            return spdlog::level::err;
+    }
+}
+
+void writeFormatted(LogLevel level, uint64_t suppressed, const char* format, va_list args)
+{
+    const spdlog::level::level_enum spdLevel = toSpdlog(level);
+    if (!spdlog::default_logger_raw()->should_log(spdLevel))
+    {
+        return;
+    }
+
+    char message[512];
+    std::vsnprintf(message, sizeof(message), format, args);
+
+    if (suppressed > 0)
+    {
+        spdlog::log(spdLevel, "{} ({} similar messages suppressed)", message, suppressed);
+    }
+    else
+    {
+        spdlog::log(spdLevel, "{}", message);
+    }
+}
+
+uint64_t steadyNowNs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+}  // namespace
+
+void Log::write(LogLevel level, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    writeFormatted(level, 0, format, args);
+    va_end(args);
+}
+
+void Log::writeAfterSuppressed(LogLevel level, uint64_t suppressed, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    writeFormatted(level, suppressed, format, args);
+    va_end(args);
+}
+
+LogRateLimiter::LogRateLimiter(uint32_t burst, double windowSeconds)
+    : m_burst(burst), m_windowNs(static_cast<uint64_t>(windowSeconds * 1.0e9))
+{
+}
+
+bool LogRateLimiter::allow(uint64_t& suppressed)
+{
+    const uint64_t now   = steadyNowNs();
+    uint64_t       start = m_windowStart.load(std::memory_order_relaxed);
+
+    // Whoever moves the window forward also reopens it; losers of the race just count against the new window
+    if (now - start >= m_windowNs && m_windowStart.compare_exchange_strong(start, now, std::memory_order_relaxed))
+    {
+        m_countInWindow.store(0, std::memory_order_relaxed);
+    }
+
+    if (m_countInWindow.fetch_add(1, std::memory_order_relaxed) < m_burst)
+    {
+        suppressed = m_suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    m_suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
@@ -0,0 +1,265 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace
+{
+thread_local void* t_buffer = nullptr;  // This thread's Profiler::ThreadBuffer, created on first record
+
+double toMs(uint64_t ns)
+{
+    return static_cast<double>(ns) / 1.0e6;
+}
+
+// Nearest-rank percentile of an ascending range
+uint64_t percentile(const std::vector<uint64_t>& sorted, double p)
+{
+    const size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+void appendJsonString(std::string& out, const char* text)
+{
+    out += '"';
+    for (const char* c = text; *c; ++c)
+    {
+        switch (*c)
+        {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20)
+                {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+                    out += escaped;
+                }
+                else
+                {
+                    out += *c;
+                }
+        }
+    }
+    out += '"';
+}
+}  // namespace
+
+Profiler& Profiler::instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+uint64_t Profiler::now()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+Profiler::ThreadBuffer& Profiler::bufferForThisThread()
+{
+    if (!t_buffer)
+    {
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        m_buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(m_buffers.size())));
+        t_buffer = m_buffers.back().get();
+    }
+    return *static_cast<ThreadBuffer*>(t_buffer);
+}
+
+void Profiler::record(const char* name, uint64_t startNs, uint64_t endNs)
+{
+    ThreadBuffer&  buffer = bufferForThisThread();
+    const uint64_t index  = buffer.head.load(std::memory_order_relaxed);
+    Slot&          slot   = buffer.slots[index % kSamplesPerThread];
+
+    // Announce the overwrite before touching the slot so collect() can detect torn reads
+    buffer.writing.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.startNs.store(startNs, std::memory_order_relaxed);
+    slot.durationNs.store(endNs > startNs ? endNs - startNs : 0, std::memory_order_relaxed);
+
+    // Publishes the slot; readers never look past head
+    buffer.head.store(index + 1, std::memory_order_release);
+}
+
+std::vector<ProfileSample> Profiler::collect() const
+{
+    std::vector<ProfileSample> samples;
+
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    for (const auto& buffer : m_buffers)
+    {
+        const uint64_t head  = buffer->head.load(std::memory_order_acquire);
+        const uint64_t floor = buffer->floor.load(std::memory_order_relaxed);
+        const uint64_t first = std::max(floor, head > kSamplesPerThread ? head - kSamplesPerThread : 0);
+
+        const size_t copiedFrom = samples.size();
+        for (uint64_t index = first; index < head; ++index)
+        {
+            const Slot&   slot = buffer->slots[index % kSamplesPerThread];
+            ProfileSample sample;
+            sample.name       = slot.name.load(std::memory_order_relaxed);
+            sample.threadId   = buffer->threadId;
+            sample.startNs    = slot.startNs.load(std::memory_order_relaxed);
+            sample.durationNs = slot.durationNs.load(std::memory_order_relaxed);
+            samples.push_back(sample);
+        }
+
+        // Drop anything the owning thread started overwriting while we were copying
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t writing = buffer->writing.load(std::memory_order_relaxed);
+        if (writing > kSamplesPerThread && writing - kSamplesPerThread > first)
+        {
+            const uint64_t overwritten = std::min(head, writing - kSamplesPerThread) - first;
+            samples.erase(samples.begin() + static_cast<std::ptrdiff_t>(copiedFrom),
+                          samples.begin() + static_cast<std::ptrdiff_t>(copiedFrom + overwritten));
+        }
+    }
+
+    std::sort(samples.begin(),
+              samples.end(),
+              [](const ProfileSample& a, const ProfileSample& b) { return a.startNs < b.startNs; });
+    return samples;
+}
+
+void Profiler::clear()
+{
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    for (const auto& buffer : m_buffers)
+    {
+        buffer->floor.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
+std::vector<ProfileScopeStats> Profiler::computeStats() const
+{
+    // Keyed by text: the same literal may have different addresses in different translation units
+    std::map<std::string, std::vector<uint64_t>> durations;
+    for (const ProfileSample& sample : collect())
+    {
+        if (sample.name)
+        {
+            durations[sample.name].push_back(sample.durationNs);
+        }
+    }
+
+    std::vector<ProfileScopeStats> stats;
+    stats.reserve(durations.size());
+    for (auto& [name, values] : durations)
+    {
+        std::sort(values.begin(), values.end());
+
+        uint64_t total = 0;
+        for (uint64_t value : values)
+        {
+            total += value;
+        }
+
+        ProfileScopeStats scope;
+        scope.name    = name;
+        scope.count   = values.size();
+        scope.totalMs = toMs(total);
+        scope.meanMs  = scope.totalMs / static_cast<double>(values.size());
+        scope.p50Ms   = toMs(percentile(values, 50.0));
+        scope.p95Ms   = toMs(percentile(values, 95.0));
+        scope.p99Ms   = toMs(percentile(values, 99.0));
+        scope.maxMs   = toMs(values.back());
+        stats.push_back(std::move(scope));
+    }
+
+    std::sort(stats.begin(),
+              stats.end(),
+              [](const ProfileScopeStats& a, const ProfileScopeStats& b) { return a.totalMs > b.totalMs; });
+    return stats;
+}
+
+std::string Profiler::summary() const
+{
+    std::ostringstream out;
+    char               line[256];
+
+    std::snprintf(line,
+                  sizeof(line),
+                  "%-32s %8s %10s %10s %10s %10s %10s\n",
+                  "scope",
+                  "count",
+                  "mean ms",
+                  "p50 ms",
+                  "p95 ms",
+                  "p99 ms",
+                  "max ms");
+    out << line;
+
+    for (const ProfileScopeStats& scope : computeStats())
+    {
+        std::snprintf(line,
+                      sizeof(line),
+                      "%-32.32s %8zu %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+                      scope.name.c_str(),
+                      scope.count,
+                      scope.meanMs,
+                      scope.p50Ms,
+                      scope.p95Ms,
+                      scope.p99Ms,
+                      scope.maxMs);
+        out << line;
+    }
+    return out.str();
+}
+
+std::string Profiler::chromeTrace() const
+{
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool        first = true;
+    char        numbers[128];
+
+    for (const ProfileSample& sample : collect())
+    {
+        if (!sample.name)
+        {
+            continue;
+        }
+
+        json += first ? "\n" : ",\n";
+        first = false;
+
+        // Complete events ("X") with microsecond timestamps
+        json += "{\"name\":";
+        appendJsonString(json, sample.name);
+        std::snprintf(numbers,
+                      sizeof(numbers),
+                      ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                      sample.threadId,
+                      static_cast<double>(sample.startNs) / 1000.0,
+                      static_cast<double>(sample.durationNs) / 1000.0);
+        json += numbers;
+    }
+
+    json += "\n]}\n";
+    return json;
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    file << chromeTrace();
+    return static_cast<bool>(file);
+}
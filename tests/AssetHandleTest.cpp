@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <AssetHandle.h>
+#include <AssetRegistry.h>
+#include <CParticleEmitter.h>
+#include <CShader.h>
+#include <CTexture.h>
+
+using Systems::AssetRegistry;
+
+TEST(AssetHandleTest, EqualKeysShareAHandle)
+{
+    const AssetHandle crate = AssetHandles::intern("assets/textures/crate.png");
+    const AssetHandle grass = AssetHandles::intern("assets/textures/grass.png");
+
+    EXPECT_NE(crate, AssetHandles::kInvalid);
+    EXPECT_NE(crate, grass);
+    EXPECT_EQ(AssetHandles::intern(std::string("assets/textures/") + "crate.png"), crate);
+    EXPECT_EQ(AssetHandles::intern(""), AssetHandles::kInvalid);
+
+    EXPECT_EQ(AssetHandles::keyOf(crate), "assets/textures/crate.png");
+    EXPECT_EQ(AssetHandles::keyOf(AssetHandles::kInvalid), "");
+}
+
+TEST(AssetHandleTest, ComponentsFollowTheirPaths)
+{
+    Components::CTexture texture("assets/textures/crate.png");
+    EXPECT_EQ(texture.getTextureHandle(), AssetHandles::intern("assets/textures/crate.png"));
+
+    texture.setTexturePath("");
+    EXPECT_EQ(texture.getTextureHandle(), AssetHandles::kInvalid);
+
+    Components::CShader shader("glow.vert", "glow.frag");
+    const AssetHandle   glow = shader.getShaderHandle();
+    EXPECT_NE(glow, AssetHandles::kInvalid);
+    EXPECT_EQ(Components::CShader("glow.vert", "glow.frag").getShaderHandle(), glow);
+
+    // A fragment-only shader is a different asset from the vertex+fragment pair
+    shader.setVertexShaderPath("");
+    EXPECT_NE(shader.getShaderHandle(), glow);
+    EXPECT_NE(shader.getShaderHandle(), AssetHandles::kInvalid);
+
+    Components::CParticleEmitter emitter;
+    EXPECT_EQ(emitter.getTextureHandle(), AssetHandles::kInvalid);
+    emitter.setTexturePath("assets/textures/spark.png");
+    EXPECT_EQ(emitter.getTextureHandle(), AssetHandles::intern("assets/textures/spark.png"));
+}
+
+TEST(AssetHandleTest, ShaderParametersAreReplacedByName)
+{
+    Components::CShader shader("glow.vert", "glow.frag");
+    shader.setParameter("u_intensity", 0.5f);
+    shader.setParameter("u_tint", 1.0f, 0.5f, 0.25f);
+    shader.setParameter("u_intensity", 2.0f);
+
+    const auto& parameters = shader.getParameters();
+    ASSERT_EQ(parameters.size(), 2u);
+    EXPECT_EQ(parameters[0].name, "u_intensity");
+    EXPECT_EQ(parameters[0].nameHandle, AssetHandles::intern("u_intensity"));
+    EXPECT_EQ(parameters[0].components, 1);
+    EXPECT_FLOAT_EQ(parameters[0].value[0], 2.0f);
+    EXPECT_EQ(parameters[1].components, 3);
+    EXPECT_FLOAT_EQ(parameters[1].value[2], 0.25f);
+
+    shader.clearParameters();
+    EXPECT_TRUE(shader.getParameters().empty());
+}
+
+TEST(AssetHandleTest, RegistryLoadsEachHandleOnce)
+{
+    AssetRegistry<const int> registry;
+    const int          resource = 42;
+    int                loads    = 0;
+    auto               load     = [&]
+    {
+        ++loads;
+        return &resource;
+    };
+
+    const AssetHandle handle = AssetHandles::intern("registry/resource");
+    EXPECT_EQ(registry.resolve(handle, load), &resource);
+    EXPECT_EQ(registry.resolve(handle, load), &resource);
+    EXPECT_EQ(loads, 1);
+
+    EXPECT_EQ(registry.resolve(AssetHandles::kInvalid, load), nullptr);
+    EXPECT_EQ(loads, 1);
+
+    // Failed loads are remembered until clear()
+    const AssetHandle missing = AssetHandles::intern("registry/missing");
+    auto              fail    = [&]() -> const int*
+    {
+        ++loads;
+        return nullptr;
+    };
+    EXPECT_EQ(registry.resolve(missing, fail), nullptr);
+    EXPECT_EQ(registry.resolve(missing, fail), nullptr);
+    EXPECT_EQ(loads, 2);
+
+    registry.clear();
+    EXPECT_EQ(registry.resolve(handle, load), &resource);
+    EXPECT_EQ(loads, 3);
+}
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <World.h>
+#include <components/CParticleEmitter.h>
+
+#include <vector>
+
+namespace
+{
+struct StableValue
+{
+    int value = 0;
+
+    StableValue() = default;
+    explicit StableValue(int v) : value(v) {}
+};
+
+struct PackedValue
+{
+    int value = 0;
+
+    PackedValue() = default;
+    explicit PackedValue(int v) : value(v) {}
+};
+}  // namespace
+
+template <>
+struct ComponentStorageTraits<StableValue> : StableComponentStorage<4>
+{
+};
+
+TEST(ComponentStorageTest, StablePointerSurvivesGrowthAcrossPages)
+{
+    World  world;
+    Entity first = world.createEntity();
+
+    StableValue* ptr = world.add<StableValue>(first, 7);
+    ASSERT_NE(ptr, nullptr);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        Entity e = world.createEntity();
+        world.add<StableValue>(e, i);
+    }
+
+    EXPECT_EQ(world.get<StableValue>(first), ptr);
+    EXPECT_EQ(ptr->value, 7);
+}
+
+TEST(ComponentStorageTest, StablePointerSurvivesRemovalOfOthers)
+{
+    World               world;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 10; ++i)
+    {
+        Entity e = world.createEntity();
+        world.add<StableValue>(e, i);
+        entities.push_back(e);
+    }
+
+    StableValue* last = world.get<StableValue>(entities.back());
+
+    // Packed storage would swap the last component into each removed slot.
+    world.remove<StableValue>(entities[0]);
+    world.destroyEntity(entities[3]);
+
+    EXPECT_EQ(world.get<StableValue>(entities.back()), last);
+    EXPECT_EQ(last->value, 9);
+}
+
+TEST(ComponentStorageTest, StableIterationSkipsHolesAndReusesSlots)
+{
+    World               world;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 6; ++i)
+    {
+        Entity e = world.createEntity();
+        world.add<StableValue>(e, i);
+        world.add<PackedValue>(e, i * 10);
+        entities.push_back(e);
+    }
+
+    StableValue* removedSlot = world.get<StableValue>(entities[2]);
+    world.remove<StableValue>(entities[2]);
+    world.remove<StableValue>(entities[4]);
+
+    int visited = 0;
+    int sum     = 0;
+    world.each<StableValue>(
+        [&](Entity, StableValue& value)
+        {
+            ++visited;
+            sum += value.value;
+        });
+    EXPECT_EQ(visited, 4);
+    EXPECT_EQ(sum, 0 + 1 + 3 + 5);
+
+    int viewed = 0;
+    world.view<StableValue, PackedValue>(
+        [&](Entity, StableValue& stable, PackedValue& packed)
+        {
+            ++viewed;
+            EXPECT_EQ(stable.value * 10, packed.value);
+        });
+    EXPECT_EQ(viewed, 4);
+
+    // Most recently freed slot is reused first.
+    Entity       reused = world.createEntity();
+    StableValue* placed = world.add<StableValue>(reused, 42);
+    EXPECT_NE(placed, removedSlot);
+    EXPECT_EQ(placed, world.get<StableValue>(reused));
+
+    Entity again = world.createEntity();
+    EXPECT_EQ(world.add<StableValue>(again, 43), removedSlot);
+}
+
+TEST(ComponentStorageTest, PagedArrayDestroysOnlyLiveSlots)
+{
+    struct Counted
+    {
+        explicit Counted(int* counter) : counter(counter) {}
+        ~Counted()
+        {
+            ++(*counter);
+        }
+        int* counter;
+    };
+
+    int destroyed = 0;
+    {
+        PagedArray<Counted, 2> slots;
+        for (size_t i = 0; i < 5; ++i)
+        {
+            slots.emplace(i, &destroyed);
+        }
+        slots.erase(1);
+        EXPECT_EQ(destroyed, 1);
+        EXPECT_FALSE(slots.isLive(1));
+        EXPECT_EQ(slots.size(), 5u);
+
+        slots.emplace(1, &destroyed);
+        EXPECT_TRUE(slots.isLive(1));
+    }
+    EXPECT_EQ(destroyed, 6);
+}
+
+TEST(ComponentStorageTest, ColdDataCopiesDeepAndMovesOwnership)
+{
+    ColdData<std::vector<int>> original;
+    original->push_back(1);
+
+    ColdData<std::vector<int>> copy(original);
+    copy->push_back(2);
+    EXPECT_EQ(original->size(), 1u);
+    EXPECT_EQ(copy->size(), 2u);
+
+    const std::vector<int>*    address = &*original;
+    ColdData<std::vector<int>> moved(std::move(original));
+    EXPECT_EQ(&*moved, address);
+
+    copy = moved;
+    EXPECT_EQ(copy->size(), 1u);
+    EXPECT_NE(&*copy, address);
+}
+
+TEST(ComponentStorageTest, ColdConfigAddressSurvivesPackedSwapAndPop)
+{
+    World               world;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 4; ++i)
+    {
+        Entity e = world.createEntity();
+        world.add<Components::CParticleEmitter>(e)->setMaxParticles(100 + i);
+        entities.push_back(e);
+    }
+
+    const Components::ParticleEmitterConfig* config =
+        &world.get<Components::CParticleEmitter>(entities.back())->getConfig();
+
+    // Removing the first emitter moves the last one into its dense slot; only the
+    // hot fields and the config handle are relocated.
+    world.remove<Components::CParticleEmitter>(entities.front());
+
+    const auto* moved = world.get<Components::CParticleEmitter>(entities.back());
+    EXPECT_EQ(&moved->getConfig(), config);
+    EXPECT_EQ(moved->getMaxParticles(), 103);
+}
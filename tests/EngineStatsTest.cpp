@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <EngineStats.h>
+
+#include <thread>
+#include <vector>
+
+TEST(StatCountersTest, CounterIsFoundByNameAndKeepsItsKind)
+{
+    StatCounters counters;
+
+    StatCounter& first = counters.counter("spawned", StatCounterKind::PerFrame);
+    StatCounter& again = counters.counter("spawned", StatCounterKind::Gauge);
+
+    EXPECT_EQ(&first, &again);
+    EXPECT_EQ(again.kind(), StatCounterKind::PerFrame);
+    EXPECT_EQ(counters.size(), 1u);
+}
+
+TEST(StatCountersTest, ReferencesStayValidAsCountersAreAdded)
+{
+    StatCounters counters;
+    StatCounter& first = counters.counter("first");
+    for (int i = 0; i < 1000; ++i)
+    {
+        counters.counter("counter" + std::to_string(i));
+    }
+
+    first.add(3);
+    EXPECT_EQ(counters.counter("first").value(), 3);
+}
+
+TEST(StatCountersTest, SnapshotResetsOnlyPerFrameCounters)
+{
+    StatCounters counters;
+    StatCounter& gauge    = counters.counter("gauge");
+    StatCounter& perFrame = counters.counter("perFrame", StatCounterKind::PerFrame);
+
+    gauge.set(10);
+    perFrame.add(2);
+    perFrame.add();
+
+    std::vector<StatCounterValue> values;
+    counters.snapshot(values);
+    ASSERT_EQ(values.size(), 2u);
+    EXPECT_EQ(values[0].name, "gauge");
+    EXPECT_EQ(values[0].value, 10);
+    EXPECT_EQ(values[1].name, "perFrame");
+    EXPECT_EQ(values[1].value, 3);
+
+    counters.snapshot(values);
+    EXPECT_EQ(values[0].value, 10);
+    EXPECT_EQ(values[1].value, 0);
+}
+
+TEST(StatCountersTest, ConcurrentAddsAreNotLost)
+{
+    StatCounters counters;
+    StatCounter& hits = counters.counter("hits", StatCounterKind::PerFrame);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&hits]()
+            {
+                for (int i = 0; i < 10000; ++i)
+                {
+                    hits.add();
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(hits.value(), 40000);
+}
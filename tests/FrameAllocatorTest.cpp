@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <FrameAllocator.h>
+#include <World.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct SortKey
+{
+    int key = 0;
+};
+}  // namespace
+
+TEST(FrameAllocatorTest, ResetReusesTheSameMemory)
+{
+    FrameAllocator allocator(1024);
+
+    void* first = allocator.allocate(64, 8);
+    EXPECT_GE(allocator.getBytesUsed(), 64u);
+
+    allocator.reset();
+    EXPECT_EQ(allocator.getBytesUsed(), 0u);
+    EXPECT_EQ(allocator.allocate(64, 8), first);
+}
+
+TEST(FrameAllocatorTest, AllocationsHonourAlignment)
+{
+    FrameAllocator allocator(1024);
+
+    (void)allocator.allocate(1, 1);
+    void* aligned = allocator.allocate(32, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64, 0u);
+}
+
+TEST(FrameAllocatorTest, OverflowGrowsTheBlockOnReset)
+{
+    FrameAllocator allocator(128);
+
+    (void)allocator.allocate(100, 8);
+    (void)allocator.allocate(100, 8);
+    EXPECT_EQ(allocator.getOverflowCount(), 1u);
+    const size_t used = allocator.getBytesUsed();
+
+    allocator.reset();
+    EXPECT_EQ(allocator.getOverflowCount(), 0u);
+    EXPECT_GE(allocator.getCapacity(), used);
+    EXPECT_EQ(allocator.getHighWaterMark(), used);
+
+    (void)allocator.allocate(100, 8);
+    (void)allocator.allocate(100, 8);
+    EXPECT_EQ(allocator.getOverflowCount(), 0u);
+}
+
+TEST(FrameAllocatorTest, BacksPmrContainers)
+{
+    FrameAllocator allocator(4096);
+
+    std::pmr::vector<int> values(&allocator);
+    for (int i = 0; i < 100; ++i)
+    {
+        values.push_back(i);
+    }
+
+    EXPECT_EQ(values.back(), 99);
+    EXPECT_GE(allocator.getBytesUsed(), 100 * sizeof(int));
+    EXPECT_EQ(allocator.getOverflowCount(), 0u);
+}
+
+TEST(FrameAllocatorTest, ConcurrentAllocationsDoNotOverlap)
+{
+    constexpr int  kThreads   = 4;
+    constexpr int  kPerThread = 1000;
+    FrameAllocator allocator(kThreads * kPerThread * 16);
+
+    std::vector<std::vector<int*>> results(kThreads);
+    std::vector<std::thread>       threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back(
+            [&allocator, &results, t]()
+            {
+                for (int i = 0; i < kPerThread; ++i)
+                {
+                    int* value = static_cast<int*>(allocator.allocate(sizeof(int), alignof(int)));
+                    *value     = t * kPerThread + i;
+                    results[t].push_back(value);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int t = 0; t < kThreads; ++t)
+    {
+        for (int i = 0; i < kPerThread; ++i)
+        {
+            EXPECT_EQ(*results[t][i], t * kPerThread + i);
+        }
+    }
+}
+
+TEST(FrameAllocatorTest, ViewSortedKeepsVisitOrderForEqualKeysInFrameMemory)
+{
+    FrameAllocator allocator(4096);
+    World          world;
+    world.setFrameMemory(&allocator);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        Entity entity = world.createEntity();
+        world.add<SortKey>(entity, SortKey{i % 2});
+    }
+
+    std::vector<Entity> visited;
+    world.components().view<SortKey>([&](Entity entity, SortKey&) { visited.push_back(entity); });
+
+    auto keyOf = [&world](Entity entity) { return world.components().tryGet<SortKey>(entity)->key; };
+
+    std::vector<Entity> sorted;
+    world.components().viewSorted<SortKey>([&](Entity entity, SortKey&) { sorted.push_back(entity); },
+                                           [&](Entity a, Entity b) { return keyOf(a) < keyOf(b); });
+
+    std::vector<Entity> expected;
+    for (int key = 0; key < 2; ++key)
+    {
+        for (Entity entity : visited)
+        {
+            if (keyOf(entity) == key)
+            {
+                expected.push_back(entity);
+            }
+        }
+    }
+
+    EXPECT_EQ(sorted, expected);
+    EXPECT_GT(allocator.getBytesUsed(), 0u);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <FramePacer.h>
+
+#include <chrono>
+#include <thread>
+
+TEST(FramePacerTest, FirstFrameUsesTheNominalPeriod)
+{
+    FramePacer unlimited;
+    EXPECT_FLOAT_EQ(unlimited.waitForNextFrame(), 1.0f / 60.0f);
+
+    FramePacer paced(100.0);
+    EXPECT_NEAR(paced.waitForNextFrame(), 0.01f, 1e-6f);
+    EXPECT_EQ(paced.getFrameCount(), 1u);
+}
+
+TEST(FramePacerTest, WaitsUntilEachDeadline)
+{
+    FramePacer pacer(200.0);
+
+    const auto start = FramePacer::Clock::now();
+    for (int i = 0; i < 11; ++i)
+    {
+        pacer.waitForNextFrame();
+    }
+    const auto elapsed = FramePacer::Clock::now() - start;
+
+    // Ten periods of 5 ms separate the first and last frame start
+    EXPECT_GE(elapsed, std::chrono::milliseconds(50));
+    EXPECT_GE(pacer.getRawDeltaTime(), 0.005f - 1e-4f);
+}
+
+TEST(FramePacerTest, OverrunningFramesCountAsMissedDeadlines)
+{
+    FramePacer pacer(1000.0);
+    pacer.waitForNextFrame();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    pacer.waitForNextFrame();
+
+    EXPECT_EQ(pacer.getMissedDeadlines(), 1u);
+    EXPECT_GE(pacer.getRawDeltaTime(), 0.005f);
+}
+
+TEST(FramePacerTest, SmoothedDeltaAveragesRecentFrames)
+{
+    FramePacer pacer;
+    pacer.waitForNextFrame();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const float smoothed = pacer.waitForNextFrame();
+
+    // The spike is averaged with the nominal first frame rather than passed on as-is
+    EXPECT_LT(smoothed, pacer.getRawDeltaTime());
+    EXPECT_NEAR(smoothed, (1.0f / 60.0f + pacer.getRawDeltaTime()) / 2.0f, 1e-6f);
+}
+
+TEST(FramePacerTest, ResetClearsCounters)
+{
+    FramePacer pacer(1000.0);
+    pacer.waitForNextFrame();
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    pacer.waitForNextFrame();
+
+    pacer.reset();
+    EXPECT_EQ(pacer.getMissedDeadlines(), 0u);
+    EXPECT_EQ(pacer.getFrameCount(), 0u);
+    EXPECT_FLOAT_EQ(pacer.getDeltaTime(), 0.0f);
+}
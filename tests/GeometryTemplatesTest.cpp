@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <GeometryTemplates.h>
+
+#include <algorithm>
+#include <cmath>
+
+using Systems::GeometryTemplates;
+
+TEST(GeometryTemplatesTest, LargerCirclesGetMoreSegments)
+{
+    EXPECT_EQ(GeometryTemplates::circleSegments(2.0f), 8u);
+    EXPECT_EQ(GeometryTemplates::circleSegments(25.0f), 16u);
+    EXPECT_EQ(GeometryTemplates::circleSegments(100.0f), 32u);
+    EXPECT_EQ(GeometryTemplates::circleSegments(5000.0f), 64u);
+
+    size_t previous = 0;
+    for (float radius = 0.5f; radius < 1000.0f; radius *= 1.5f)
+    {
+        const size_t segments = GeometryTemplates::circleSegments(radius);
+        EXPECT_GE(segments, previous);
+        previous = segments;
+
+        // The chosen level keeps the outline within half a pixel, up to the finest level
+        const float error = radius * (1.0f - std::cos(3.14159265f / static_cast<float>(segments)));
+        if (segments < 64)
+        {
+            EXPECT_LE(error, 0.5f) << "radius " << radius;
+        }
+    }
+}
+
+TEST(GeometryTemplatesTest, UnitCircleStartsAtTheTop)
+{
+    for (size_t segments : GeometryTemplates::kCircleLods)
+    {
+        const sf::Vector2f* points = GeometryTemplates::unitCircle(segments);
+        ASSERT_NE(points, nullptr);
+        EXPECT_NEAR(points[0].x, 0.0f, 1e-6f);
+        EXPECT_NEAR(points[0].y, -1.0f, 1e-6f);
+        for (size_t i = 0; i < segments; ++i)
+        {
+            EXPECT_NEAR(std::hypot(points[i].x, points[i].y), 1.0f, 1e-5f);
+        }
+    }
+
+    EXPECT_EQ(GeometryTemplates::unitCircle(30), nullptr);
+}
+
+TEST(GeometryTemplatesTest, ThickLinesAreOneQuadOfTheirThickness)
+{
+    sf::Vertex quad[GeometryTemplates::kLineQuadVertices];
+    GeometryTemplates::writeThickLine(quad, sf::Vector2f(10.0f, 20.0f), sf::Vector2f(110.0f, 20.0f), 6.0f, sf::Color::Red);
+
+    float minY = quad[0].position.y;
+    float maxY = quad[0].position.y;
+    for (const sf::Vertex& vertex : quad)
+    {
+        minY = std::min(minY, vertex.position.y);
+        maxY = std::max(maxY, vertex.position.y);
+        EXPECT_GE(vertex.position.x, 10.0f);
+        EXPECT_LE(vertex.position.x, 110.0f);
+        EXPECT_EQ(vertex.color, sf::Color::Red);
+    }
+    EXPECT_FLOAT_EQ(minY, 17.0f);
+    EXPECT_FLOAT_EQ(maxY, 23.0f);
+}
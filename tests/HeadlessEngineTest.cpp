@@ -0,0 +1,326 @@
+#include <gtest/gtest.h>
+
+#include <GameEngine.h>
+
+#include <components/CParticleEmitter.h>
+#include <components/CPhysicsBody2D.h>
+#include <components/CTransform.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+Systems::WindowConfig headlessConfig()
+{
+    Systems::WindowConfig config;
+    config.headless = true;
+    return config;
+}
+
+class ThrottledSystem : public Systems::ISystem
+{
+public:
+    void update(float deltaTime, World& /*world*/) override
+    {
+        updates++;
+        elapsed += deltaTime;
+    }
+
+    void declareAccess(Systems::SystemAccess& /*access*/) const override {}
+
+    float tickInterval() const override
+    {
+        return 0.09f;
+    }
+
+    int   updates = 0;
+    float elapsed = 0.0f;
+};
+
+sf::Event keyEvent(sf::Event::EventType type, sf::Keyboard::Key key)
+{
+    sf::Event event{};
+    event.type     = type;
+    event.key.code = key;
+    return event;
+}
+}  // namespace
+
+TEST(HeadlessEngineTest, RunsWithoutWindowOrAudioDevice)
+{
+    GameEngine engine(headlessConfig());
+
+    EXPECT_TRUE(engine.isHeadless());
+    EXPECT_TRUE(engine.is_running());
+    EXPECT_EQ(engine.getRenderer().getWindow(), nullptr);
+    EXPECT_EQ(engine.getAudioSystem().getBackend(), AudioBackend::Null);
+
+    // Rendering is a no-op rather than an error
+    engine.render();
+}
+
+TEST(HeadlessEngineTest, StepAdvancesPhysicsOneFixedStepAtATime)
+{
+    GameEngine engine(headlessConfig(), Vec2(0.0f, -10.0f));
+    World&     world = engine.world();
+
+    Entity body = world.createEntity();
+    world.add<Components::CTransform>(body, Vec2(0.0f, 10.0f), Vec2(1.0f, 1.0f), 0.0f);
+    world.add<Components::CPhysicsBody2D>(body);
+
+    engine.step(60);
+
+    const auto* transform = world.components().tryGet<Components::CTransform>(body);
+    ASSERT_NE(transform, nullptr);
+    EXPECT_LT(transform->getPosition().y, 10.0f);
+    EXPECT_FLOAT_EQ(engine.getInterpolationAlpha(), 0.0f);
+}
+
+TEST(HeadlessEngineTest, NullAudioBackendAcceptsKnownSoundsOnly)
+{
+    GameEngine engine(headlessConfig());
+    auto&      audio = engine.getAudioSystem();
+    Entity     owner = engine.createEntity();
+
+    EXPECT_TRUE(audio.loadSound("hit", "does/not/need/to/exist.wav", AudioType::SFX));
+    EXPECT_TRUE(audio.playSfx(owner, "hit"));
+    EXPECT_FALSE(audio.playSfx(owner, "missing"));
+
+    audio.unloadSound("hit");
+    EXPECT_FALSE(audio.playSfx(owner, "hit"));
+}
+
+TEST(HeadlessEngineTest, TickIntervalThrottlesSystemUpdates)
+{
+    GameEngine engine(headlessConfig());
+    auto&      system = engine.addSystem<ThrottledSystem>();
+
+    engine.step(60);
+
+    // Every sixth 1/60 s step crosses the 0.09 s interval and passes on all time accumulated since
+    EXPECT_EQ(system.updates, 10);
+    EXPECT_NEAR(system.elapsed, 60 * engine.getTimeStep(), 1e-4f);
+}
+
+TEST(HeadlessEngineTest, StaggeredTicksPassOnOnlyTheTimeThatElapsed)
+{
+    GameEngine engine(headlessConfig());
+    auto&      first  = engine.addSystem<ThrottledSystem>();
+    auto&      second = engine.addSystem<ThrottledSystem>();
+
+    // Time at each system's latest tick; everything before it must have been passed on, and nothing more
+    float now          = 0.0f;
+    float firstTickAt  = 0.0f;
+    float secondTickAt = 0.0f;
+    int   firstSeen    = 0;
+    int   secondSeen   = 0;
+    for (int i = 0; i < 120; ++i)
+    {
+        engine.step(1);
+        now += engine.getTimeStep();
+        if (first.updates != firstSeen)
+        {
+            firstSeen   = first.updates;
+            firstTickAt = now;
+        }
+        if (second.updates != secondSeen)
+        {
+            secondSeen   = second.updates;
+            secondTickAt = now;
+        }
+    }
+
+    ASSERT_GT(first.updates, 0);
+    ASSERT_GT(second.updates, 0);
+    EXPECT_NEAR(first.elapsed, firstTickAt, 1e-4f);
+    EXPECT_NEAR(second.elapsed, secondTickAt, 1e-4f);
+
+    // The second system's first tick is staggered, so the two do not tick in lockstep
+    EXPECT_NE(firstTickAt, secondTickAt);
+}
+
+TEST(HeadlessEngineTest, StatsSnapshotCountsWorldAndCustomCounters)
+{
+    GameEngine engine(headlessConfig());
+    World&     world = engine.world();
+
+    StatCounter& perFrame = engine.getStatCounters().counter("Test.perFrame", StatCounterKind::PerFrame);
+    StatCounter& gauge    = engine.getStatCounters().counter("Test.gauge");
+    EXPECT_EQ(&engine.getStatCounters().counter("Test.gauge"), &gauge);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Entity entity = world.createEntity();
+        world.add<Components::CTransform>(entity, Vec2(0.0f, static_cast<float>(i)), Vec2(1.0f, 1.0f), 0.0f);
+        world.add<Components::CPhysicsBody2D>(entity);
+    }
+    world.queueDestroy(world.createEntity());
+
+    perFrame.add(4);
+    gauge.set(7);
+    engine.step(1);
+
+    const EngineStats& stats = engine.stats();
+    EXPECT_EQ(stats.frame, 1u);
+    EXPECT_EQ(stats.entityCount, 3u);
+    EXPECT_EQ(stats.commandBufferSize, 1u);
+    EXPECT_EQ(stats.physicsBodies, 3u);
+    EXPECT_EQ(stats.drawCalls, 0u);
+
+    auto transforms = std::find_if(stats.componentCounts.begin(),
+                                   stats.componentCounts.end(),
+                                   [](const ComponentTypeCount& entry) { return entry.typeName == "CTransform"; });
+    ASSERT_NE(transforms, stats.componentCounts.end());
+    EXPECT_EQ(transforms->count, 3u);
+
+    ASSERT_EQ(stats.counters.size(), 2u);
+    EXPECT_EQ(stats.counters[0].name, "Test.perFrame");
+    EXPECT_EQ(stats.counters[0].value, 4);
+    EXPECT_EQ(stats.counters[1].value, 7);
+
+    // Per-frame counters restart every update, gauges keep their value
+    engine.step(1);
+    EXPECT_EQ(engine.stats().counters[0].value, 0);
+    EXPECT_EQ(engine.stats().counters[1].value, 7);
+    EXPECT_EQ(engine.stats().commandBufferSize, 0u);
+}
+
+TEST(HeadlessEngineTest, ParticleEmittersTrackTheBoundsOfTheirLiveParticles)
+{
+    GameEngine engine(headlessConfig());
+    World&     world = engine.world();
+
+    Entity entity = world.createEntity();
+    world.add<Components::CTransform>(entity, Vec2(20.0f, -5.0f), Vec2(1.0f, 1.0f), 0.0f);
+    auto* emitter = world.add<Components::CParticleEmitter>(entity);
+    emitter->setEmissionRate(200.0f);
+    emitter->setMinLifetime(5.0f);
+    emitter->setMaxLifetime(5.0f);
+    emitter->setMinSize(0.1f);
+    emitter->setMaxSize(0.1f);
+
+    Vec2 min, max;
+    EXPECT_FALSE(emitter->getParticleBounds(min, max));
+
+    engine.step(10);
+    ASSERT_TRUE(emitter->getParticleBounds(min, max));
+
+    size_t alive = 0;
+    for (const Components::Particle& particle : emitter->getParticles())
+    {
+        if (particle.alive)
+        {
+            EXPECT_GE(particle.position.x - 0.1f, min.x);
+            EXPECT_GE(particle.position.y - 0.1f, min.y);
+            EXPECT_LE(particle.position.x + 0.1f, max.x);
+            EXPECT_LE(particle.position.y + 0.1f, max.y);
+            ++alive;
+        }
+    }
+    EXPECT_GT(alive, 0u);
+
+    // Once every particle has died (6 s at the default 60 Hz step) the emitter reports no bounds
+    emitter->setEmissionRate(0.0f);
+    engine.step(360);
+    EXPECT_FALSE(emitter->getParticleBounds(min, max));
+}
+
+TEST(HeadlessEngineTest, EmitterVerticesAreTrianglesSoTheyBatchWithSprites)
+{
+    GameEngine engine(headlessConfig());
+    World&     world = engine.world();
+
+    Entity entity = world.createEntity();
+    world.add<Components::CTransform>(entity, Vec2(2.0f, 2.0f), Vec2(1.0f, 1.0f), 0.0f);
+    auto* emitter = world.add<Components::CParticleEmitter>(entity);
+    emitter->setEmissionRate(200.0f);
+    emitter->setMinLifetime(5.0f);
+    emitter->setMaxLifetime(5.0f);
+    engine.step(10);
+
+    size_t alive = 0;
+    for (const Components::Particle& particle : emitter->getParticles())
+    {
+        alive += particle.alive ? 1 : 0;
+    }
+    ASSERT_GT(alive, 0u);
+
+    sf::VertexArray vertices;
+    EXPECT_EQ(engine.getParticleSystem().buildEmitterVertices(entity, world, vertices), nullptr);
+    EXPECT_EQ(vertices.getPrimitiveType(), sf::Triangles);
+    EXPECT_EQ(vertices.getVertexCount(), alive * 6);
+}
+
+TEST(HeadlessEngineTest, EmitterScreenBoundsUseTheEnginePixelScale)
+{
+    GameEngine engine(headlessConfig(), Vec2(0.0f, -10.0f), 6, 1.0f / 60.0f, 32.0f);
+    World&     world = engine.world();
+    EXPECT_FLOAT_EQ(engine.getParticleSystem().getPixelsPerMeter(), 32.0f);
+
+    Entity entity = world.createEntity();
+    world.add<Components::CTransform>(entity, Vec2(20.0f, 5.0f), Vec2(1.0f, 1.0f), 0.0f);
+    auto* emitter = world.add<Components::CParticleEmitter>(entity);
+    emitter->setEmissionRate(200.0f);
+    emitter->setMinLifetime(5.0f);
+    emitter->setMaxLifetime(5.0f);
+
+    engine.step(10);
+    Vec2         min, max;
+    sf::Vector2f screenMin, screenMax;
+    ASSERT_TRUE(emitter->getParticleBounds(min, max));
+    ASSERT_TRUE(engine.getParticleSystem().getEmitterScreenBounds(entity, world, screenMin, screenMax));
+
+    // Culling has to agree with where the quads are drawn: 32 px per meter, Y flipped (600 px without a window)
+    EXPECT_FLOAT_EQ(screenMin.x, min.x * 32.0f);
+    EXPECT_FLOAT_EQ(screenMax.x, max.x * 32.0f);
+    EXPECT_FLOAT_EQ(screenMin.y, 600.0f - max.y * 32.0f);
+    EXPECT_FLOAT_EQ(screenMax.y, 600.0f - min.y * 32.0f);
+}
+
+TEST(HeadlessEngineTest, ReplayFeedsRecordedInputBackFrameByFrame)
+{
+    Systems::InputRecording recording;
+    {
+        GameEngine engine(headlessConfig());
+        auto&      input = engine.getInputManager();
+
+        input.startRecording(recording);
+        engine.step(1);
+        input.processEvent(keyEvent(sf::Event::KeyPressed, sf::Keyboard::Space));
+        engine.step(2);
+        input.processEvent(keyEvent(sf::Event::KeyReleased, sf::Keyboard::Space));
+        engine.step(1);
+        input.stopRecording();
+    }
+
+    // Events belong to the update that follows them
+    ASSERT_EQ(recording.getFrameCount(), 4u);
+    EXPECT_TRUE(recording.getFrames()[0].events.empty());
+    EXPECT_EQ(recording.getFrames()[1].events.size(), 1u);
+    EXPECT_TRUE(recording.getFrames()[2].events.empty());
+    EXPECT_EQ(recording.getFrames()[3].events.size(), 1u);
+
+    GameEngine engine(headlessConfig());
+    auto&      input = engine.getInputManager();
+
+    ActionBinding jump;
+    jump.keys = {KeyCode::Space};
+    input.bindAction("Jump", jump);
+
+    std::vector<ActionState> states;
+    input.subscribe(
+        [&states](const InputEvent& event)
+        {
+            if (event.type == InputEventType::Action && event.action.actionName == "Jump")
+            {
+                states.push_back(event.action.state);
+            }
+        });
+
+    EXPECT_EQ(engine.replayInput(recording), 4u);
+    EXPECT_FALSE(input.isReplaying());
+    EXPECT_EQ(states, (std::vector<ActionState>{ActionState::Pressed, ActionState::Held, ActionState::Released}));
+    EXPECT_FALSE(input.isKeyDown(KeyCode::Space));
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <InputRecording.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+sf::Event keyEvent(sf::Event::EventType type, sf::Keyboard::Key key, bool shift)
+{
+    sf::Event event{};
+    event.type        = type;
+    event.key.code    = key;
+    event.key.shift   = shift;
+    event.key.control = false;
+    event.key.alt     = false;
+    event.key.system  = false;
+    return event;
+}
+
+sf::Event mouseButtonEvent(sf::Mouse::Button button, int x, int y)
+{
+    sf::Event event{};
+    event.type               = sf::Event::MouseButtonPressed;
+    event.mouseButton.button = button;
+    event.mouseButton.x      = x;
+    event.mouseButton.y      = y;
+    return event;
+}
+
+sf::Event wheelEvent(float delta, int x, int y)
+{
+    sf::Event event{};
+    event.type                   = sf::Event::MouseWheelScrolled;
+    event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+    event.mouseWheelScroll.delta = delta;
+    event.mouseWheelScroll.x     = x;
+    event.mouseWheelScroll.y     = y;
+    return event;
+}
+
+Systems::InputRecording sampleRecording()
+{
+    sf::Event resized{};
+    resized.type        = sf::Event::Resized;
+    resized.size.width  = 1280;
+    resized.size.height = 720;
+
+    sf::Event moved{};
+    moved.type        = sf::Event::MouseMoved;
+    moved.mouseMove.x = -5;
+    moved.mouseMove.y = 300;
+
+    Systems::InputRecording recording;
+    recording.addFrame(0.016f, {keyEvent(sf::Event::KeyPressed, sf::Keyboard::W, true), moved});
+    recording.addFrame(0.017f, {});
+    recording.addFrame(0.015f,
+                       {mouseButtonEvent(sf::Mouse::Right, 10, 20),
+                        wheelEvent(-1.5f, 3, 4),
+                        resized,
+                        keyEvent(sf::Event::KeyReleased, sf::Keyboard::W, false)});
+    return recording;
+}
+}  // namespace
+
+TEST(InputRecordingTest, DropsEventTypesInputIgnores)
+{
+    sf::Event focus{};
+    focus.type = sf::Event::GainedFocus;
+
+    Systems::InputRecording recording;
+    recording.addFrame(0.016f, {focus, keyEvent(sf::Event::KeyPressed, sf::Keyboard::A, false)});
+
+    ASSERT_EQ(recording.getFrameCount(), 1u);
+    EXPECT_EQ(recording.getEventCount(), 1u);
+    EXPECT_FALSE(Systems::InputRecording::isRecordable(focus));
+}
+
+TEST(InputRecordingTest, SerializeRoundTripsEveryEvent)
+{
+    const Systems::InputRecording original = sampleRecording();
+
+    Systems::InputRecording    decoded;
+    const std::vector<uint8_t> data = original.serialize();
+    ASSERT_TRUE(decoded.deserialize(data.data(), data.size()));
+
+    ASSERT_EQ(decoded.getFrameCount(), 3u);
+    EXPECT_EQ(decoded.getEventCount(), 6u);
+    EXPECT_NEAR(decoded.getDuration(), 0.048, 1e-6);
+
+    const auto& frames = decoded.getFrames();
+    EXPECT_FLOAT_EQ(frames[1].deltaTime, 0.017f);
+
+    const sf::Event& key = frames[0].events[0];
+    EXPECT_EQ(key.type, sf::Event::KeyPressed);
+    EXPECT_EQ(key.key.code, sf::Keyboard::W);
+    EXPECT_TRUE(key.key.shift);
+    EXPECT_FALSE(key.key.control);
+
+    EXPECT_EQ(frames[0].events[1].mouseMove.x, -5);
+    EXPECT_EQ(frames[0].events[1].mouseMove.y, 300);
+
+    const sf::Event& button = frames[2].events[0];
+    EXPECT_EQ(button.type, sf::Event::MouseButtonPressed);
+    EXPECT_EQ(button.mouseButton.button, sf::Mouse::Right);
+    EXPECT_EQ(button.mouseButton.y, 20);
+
+    EXPECT_FLOAT_EQ(frames[2].events[1].mouseWheelScroll.delta, -1.5f);
+    EXPECT_EQ(frames[2].events[2].size.width, 1280u);
+    EXPECT_EQ(frames[2].events[3].type, sf::Event::KeyReleased);
+}
+
+TEST(InputRecordingTest, RejectsTruncatedOrForeignData)
+{
+    const std::vector<uint8_t> data = sampleRecording().serialize();
+
+    Systems::InputRecording decoded;
+    EXPECT_FALSE(decoded.deserialize(data.data(), data.size() - 1));
+    EXPECT_EQ(decoded.getFrameCount(), 0u);
+
+    const std::vector<uint8_t> foreign = {'n', 'o', 'p', 'e', 1, 0, 0, 0, 0, 0};
+    EXPECT_FALSE(decoded.deserialize(foreign.data(), foreign.size()));
+}
+
+TEST(InputRecordingTest, SavesAndLoadsFiles)
+{
+    const std::string path = ::testing::TempDir() + "input_recording_test.bin";
+
+    ASSERT_TRUE(sampleRecording().saveToFile(path));
+
+    Systems::InputRecording loaded;
+    ASSERT_TRUE(loaded.loadFromFile(path));
+    EXPECT_EQ(loaded.getEventCount(), 6u);
+
+    std::remove(path.c_str());
+    EXPECT_FALSE(loaded.loadFromFile(path));
+}
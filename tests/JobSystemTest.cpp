@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <systems/JobSystem.h>
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using Systems::JobCounter;
+using Systems::JobSystem;
+
+TEST(JobSystemTest, ScheduledJobsCompleteBeforeWaitReturns)
+{
+    JobSystem        jobs(3);
+    JobCounter       counter;
+    std::atomic<int> executed{0};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        jobs.schedule([&executed]() { executed.fetch_add(1); }, &counter);
+    }
+    jobs.wait(counter);
+
+    EXPECT_TRUE(counter.isDone());
+    EXPECT_EQ(executed.load(), 1000);
+}
+
+TEST(JobSystemTest, ParallelForCoversEveryIndexOnce)
+{
+    JobSystem        jobs(4);
+    std::vector<int> hits(10007, 0);
+
+    jobs.parallelFor(hits.size(),
+                     64,
+                     [&hits](size_t begin, size_t end)
+                     {
+                         for (size_t i = begin; i < end; ++i)
+                         {
+                             ++hits[i];
+                         }
+                     });
+
+    EXPECT_EQ(std::accumulate(hits.begin(), hits.end(), 0), static_cast<int>(hits.size()));
+    for (int hit : hits)
+    {
+        ASSERT_EQ(hit, 1);
+    }
+}
+
+TEST(JobSystemTest, NestedParallelForFromJobDoesNotDeadlock)
+{
+    JobSystem        jobs(2);
+    JobCounter       counter;
+    std::atomic<int> total{0};
+
+    for (int outer = 0; outer < 8; ++outer)
+    {
+        jobs.schedule(
+            [&jobs, &total]()
+            {
+                jobs.parallelFor(100, 10, [&total](size_t begin, size_t end) { total += static_cast<int>(end - begin); });
+            },
+            &counter);
+    }
+    jobs.wait(counter);
+
+    EXPECT_EQ(total.load(), 800);
+}
+
+TEST(JobSystemTest, DependentJobsStartAfterDependencyFinishes)
+{
+    JobSystem        jobs(4);
+    JobCounter       first;
+    JobCounter       second;
+    std::atomic<int> firstDone{0};
+    std::atomic<int> sawIncomplete{0};
+
+    for (int i = 0; i < 16; ++i)
+    {
+        jobs.schedule(
+            [&firstDone]()
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                firstDone.fetch_add(1);
+            },
+            &first);
+    }
+    for (int i = 0; i < 16; ++i)
+    {
+        jobs.schedule(
+            [&firstDone, &sawIncomplete]()
+            {
+                if (firstDone.load() != 16)
+                {
+                    sawIncomplete.fetch_add(1);
+                }
+            },
+            &second,
+            &first);
+    }
+
+    jobs.wait(second);
+    EXPECT_TRUE(first.isDone());
+    EXPECT_EQ(sawIncomplete.load(), 0);
+}
+
+TEST(JobSystemTest, MainThreadJobsRunOnlyOnMainThread)
+{
+    JobSystem        jobs(2);
+    JobCounter       counter;
+    std::thread::id  mainId = std::this_thread::get_id();
+    std::atomic<int> onMain{0};
+
+    jobs.scheduleMainThread([&]() { onMain += (std::this_thread::get_id() == mainId) ? 1 : 0; }, &counter);
+    EXPECT_FALSE(counter.isDone());
+
+    // A worker job that waits on main-thread work; the main-thread wait must drain it.
+    JobCounter outer;
+    jobs.schedule([&]() { jobs.scheduleMainThread([&]() { ++onMain; }, &counter); }, &outer);
+    jobs.wait(outer);
+    jobs.wait(counter);
+
+    EXPECT_EQ(onMain.load(), 2);
+    EXPECT_EQ(jobs.runMainThreadJobs(), 0u);
+}
+
+TEST(JobSystemTest, WaitingThreadHelpsExecuteJobs)
+{
+    JobSystem        jobs(1);
+    JobCounter       counter;
+    std::thread::id  mainId = std::this_thread::get_id();
+    std::atomic<int> executed{0};
+    std::atomic<int> ranOnMain{0};
+
+    // The single worker is parked on a long job, so the waiting thread must pick up the rest.
+    std::atomic<bool> release{false};
+    jobs.schedule(
+        [&release]()
+        {
+            while (!release.load())
+            {
+                std::this_thread::yield();
+            }
+        },
+        &counter);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    for (int i = 0; i < 64; ++i)
+    {
+        jobs.schedule(
+            [&, i]()
+            {
+                ++executed;
+                ranOnMain += (std::this_thread::get_id() == mainId) ? 1 : 0;
+                if (i == 63)
+                {
+                    release = true;
+                }
+            },
+            &counter);
+    }
+    jobs.wait(counter);
+
+    EXPECT_EQ(executed.load(), 64);
+    EXPECT_GT(ranOnMain.load(), 0);
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <Log.h>
+
+#include <chrono>
+#include <thread>
+
+TEST(LogRateLimiterTest, AllowsBurstThenCountsSuppressed)
+{
+    LogRateLimiter limiter(3, 60.0);
+
+    uint64_t suppressed = 123;
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(limiter.allow(suppressed));
+        EXPECT_EQ(suppressed, 0u);
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_FALSE(limiter.allow(suppressed));
+    }
+}
+
+TEST(LogRateLimiterTest, ReportsSuppressedCountWhenWindowReopens)
+{
+    LogRateLimiter limiter(1, 0.02);
+
+    uint64_t suppressed = 0;
+    EXPECT_TRUE(limiter.allow(suppressed));
+    EXPECT_FALSE(limiter.allow(suppressed));
+    EXPECT_FALSE(limiter.allow(suppressed));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+
+    EXPECT_TRUE(limiter.allow(suppressed));
+    EXPECT_EQ(suppressed, 2u);
+
+    EXPECT_FALSE(limiter.allow(suppressed));
+}
+
+TEST(LogTest, RateLimitedMacroLimitsEachCallSite)
+{
+    // Each expansion owns its limiter, so a flood from one site does not silence another
+    int firstSite  = 0;
+    int secondSite = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        GAMEENGINE_LOG_RATE_LIMITED(LogLevel::Debug, "first site %d", (++firstSite, i));
+        GAMEENGINE_LOG_RATE_LIMITED(LogLevel::Debug, "second site %d", (++secondSite, i));
+    }
+
+    // Arguments are only evaluated for messages that get through
+    EXPECT_EQ(firstSite, 5);
+    EXPECT_EQ(secondSite, 5);
+
+    Log::write(LogLevel::Info, "plain message %s", "ok");
+}
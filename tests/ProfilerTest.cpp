@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <Profiler.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+class ProfilerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Profiler::instance().clear();
+        Profiler::setEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        Profiler::setEnabled(false);
+        Profiler::instance().clear();
+    }
+};
+}  // namespace
+
+TEST_F(ProfilerTest, DisabledScopesRecordNothing)
+{
+    Profiler::setEnabled(false);
+    {
+        GAMEENGINE_PROFILE_SCOPE("Disabled");
+    }
+
+    EXPECT_TRUE(Profiler::instance().collect().empty());
+}
+
+TEST_F(ProfilerTest, ScopesFromSeveralThreadsAreCollected)
+{
+    {
+        GAMEENGINE_PROFILE_SCOPE("Main");
+    }
+    std::thread worker(
+        []()
+        {
+            GAMEENGINE_PROFILE_SCOPE("Worker");
+        });
+    worker.join();
+
+    const auto samples = Profiler::instance().collect();
+    ASSERT_EQ(samples.size(), 2u);
+
+    std::vector<std::string> names;
+    for (const auto& sample : samples)
+    {
+        names.push_back(sample.name);
+    }
+    EXPECT_NE(std::find(names.begin(), names.end(), "Main"), names.end());
+    EXPECT_NE(std::find(names.begin(), names.end(), "Worker"), names.end());
+    EXPECT_NE(samples[0].threadId, samples[1].threadId);
+}
+
+TEST_F(ProfilerTest, StatsReportNearestRankPercentiles)
+{
+    auto& profiler = Profiler::instance();
+    for (uint64_t ms = 1; ms <= 100; ++ms)
+    {
+        profiler.record("Step", 0, ms * 1000000);
+    }
+
+    const auto stats = profiler.computeStats();
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].name, "Step");
+    EXPECT_EQ(stats[0].count, 100u);
+    EXPECT_DOUBLE_EQ(stats[0].p50Ms, 50.0);
+    EXPECT_DOUBLE_EQ(stats[0].p95Ms, 95.0);
+    EXPECT_DOUBLE_EQ(stats[0].p99Ms, 99.0);
+    EXPECT_DOUBLE_EQ(stats[0].maxMs, 100.0);
+    EXPECT_DOUBLE_EQ(stats[0].meanMs, 50.5);
+    EXPECT_NE(profiler.summary().find("Step"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, RingKeepsOnlyTheNewestSamples)
+{
+    auto& profiler = Profiler::instance();
+    for (uint64_t i = 0; i < Profiler::kSamplesPerThread + 10; ++i)
+    {
+        profiler.record("Ring", i, i + 1);
+    }
+
+    const auto samples = profiler.collect();
+    ASSERT_EQ(samples.size(), Profiler::kSamplesPerThread);
+    EXPECT_EQ(samples.front().startNs, 10u);
+    EXPECT_EQ(samples.back().startNs, Profiler::kSamplesPerThread + 9);
+}
+
+TEST_F(ProfilerTest, ChromeTraceContainsCompleteEvents)
+{
+    Profiler::instance().record("Quote\"Scope", 2000, 5000);
+
+    const std::string trace = Profiler::instance().chromeTrace();
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Quote\\\"Scope\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ts\":2.000,\"dur\":3.000"), std::string::npos);
+}
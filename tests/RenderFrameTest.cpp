@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <RenderFrame.h>
+
+using Systems::RenderBatch;
+using Systems::RenderFrame;
+
+namespace
+{
+sf::RenderStates texturedStates(const sf::Texture* texture, const sf::BlendMode& blend = sf::BlendAlpha)
+{
+    sf::RenderStates states;
+    states.texture   = texture;
+    states.blendMode = blend;
+    return states;
+}
+}  // namespace
+
+TEST(RenderFrameTest, ConsecutiveDrawsWithTheSameStateShareABatch)
+{
+    sf::Texture texture;
+    RenderFrame frame;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        frame.append(sf::Triangles, texturedStates(&texture), 6);
+    }
+
+    ASSERT_EQ(frame.batches.size(), 1u);
+    EXPECT_EQ(frame.batches[0].firstVertex, 0u);
+    EXPECT_EQ(frame.batches[0].vertexCount, 600u);
+    EXPECT_EQ(frame.vertices.size(), 600u);
+}
+
+TEST(RenderFrameTest, TextureShaderBlendOrPrimitiveChangesStartANewBatch)
+{
+    sf::Texture a;
+    sf::Texture b;
+    sf::Shader  shader;
+    RenderFrame frame;
+
+    frame.append(sf::Triangles, texturedStates(&a), 6);
+    frame.append(sf::Triangles, texturedStates(&b), 6);
+    frame.append(sf::Triangles, texturedStates(&b, sf::BlendAdd), 6);
+
+    sf::RenderStates shaded = texturedStates(&b, sf::BlendAdd);
+    shaded.shader           = &shader;
+    frame.append(sf::Triangles, shaded, 6);
+    frame.append(sf::Lines, shaded, 2);
+
+    ASSERT_EQ(frame.batches.size(), 5u);
+    EXPECT_EQ(frame.batches[4].primitive, sf::Lines);
+    EXPECT_EQ(frame.batches[4].firstVertex, 24u);
+    EXPECT_EQ(frame.batches[4].vertexCount, 2u);
+}
+
+TEST(RenderFrameTest, OnlyAdjacentDrawsMergeSoDrawOrderIsKept)
+{
+    sf::Texture a;
+    sf::Texture b;
+    RenderFrame frame;
+
+    frame.append(sf::Triangles, texturedStates(&a), 6);
+    frame.append(sf::Triangles, texturedStates(&b), 6);
+    frame.append(sf::Triangles, texturedStates(&a), 6);
+
+    ASSERT_EQ(frame.batches.size(), 3u);
+    EXPECT_EQ(frame.batches[0].states.texture, &a);
+    EXPECT_EQ(frame.batches[1].states.texture, &b);
+    EXPECT_EQ(frame.batches[2].states.texture, &a);
+}
+
+TEST(RenderFrameTest, StripPrimitivesNeverMerge)
+{
+    RenderFrame frame;
+    frame.append(sf::TriangleFan, sf::RenderStates(), 5);
+    frame.append(sf::TriangleFan, sf::RenderStates(), 5);
+
+    EXPECT_EQ(frame.batches.size(), 2u);
+}
+
+TEST(RenderFrameTest, AppendReturnsTheReservedVerticesAndClearKeepsCapacity)
+{
+    RenderFrame frame;
+    frame.append(sf::Lines, sf::RenderStates(), 2);
+
+    sf::Vertex* line = frame.append(sf::Lines, sf::RenderStates(), 2);
+    line[0].position = sf::Vector2f(1.0f, 2.0f);
+    line[1].position = sf::Vector2f(3.0f, 4.0f);
+    EXPECT_EQ(frame.vertices[3].position, sf::Vector2f(3.0f, 4.0f));
+
+    const size_t capacity = frame.vertices.capacity();
+    frame.clear();
+    EXPECT_TRUE(frame.vertices.empty());
+    EXPECT_TRUE(frame.batches.empty());
+    EXPECT_EQ(frame.vertices.capacity(), capacity);
+}
+
+TEST(RenderFrameTest, ShadedDrawsMergeOnlyWithEqualUniformValues)
+{
+    sf::Shader              shader;
+    Systems::ShaderUniforms uniforms(shader);
+    Systems::UniformValue   dim;
+    Systems::UniformValue   bright;
+    RenderFrame             frame;
+    sf::RenderStates        states;
+    Systems::ShaderBinding  binding;
+    states.shader    = &shader;
+    binding.uniforms = &uniforms;
+
+    dim.name        = AssetHandles::intern("u_intensity");
+    dim.value[0]    = 0.5f;
+    bright          = dim;
+    bright.value[0] = 2.0f;
+
+    binding.values     = &dim;
+    binding.valueCount = 1;
+    frame.append(sf::Triangles, states, 6, binding);
+    frame.append(sf::Triangles, states, 6, binding);
+
+    binding.values = &bright;
+    frame.append(sf::Triangles, states, 6, binding);
+
+    ASSERT_EQ(frame.batches.size(), 2u);
+    EXPECT_EQ(frame.batches[0].vertexCount, 12u);
+    EXPECT_EQ(frame.batches[0].uniforms, &uniforms);
+    ASSERT_EQ(frame.uniforms.size(), 2u);
+    EXPECT_EQ(frame.uniforms[frame.batches[0].firstUniform], dim);
+    EXPECT_EQ(frame.uniforms[frame.batches[1].firstUniform], bright);
+
+    frame.clear();
+    EXPECT_TRUE(frame.uniforms.empty());
+}
+
+TEST(RenderFrameTest, PassesKeepTheirBatchesApartFromTheWindows)
+{
+    sf::Texture       texture;
+    sf::RenderTexture target;
+    RenderFrame       frame;
+
+    frame.append(sf::Triangles, texturedStates(&texture), 6);
+    frame.beginPass(&target, sf::Vector2u(64, 32), sf::View());
+    EXPECT_TRUE(frame.inPass());
+    frame.append(sf::Triangles, texturedStates(&texture), 6);
+    frame.append(sf::Triangles, texturedStates(&texture), 6);
+    frame.endPass();
+    EXPECT_FALSE(frame.inPass());
+    frame.append(sf::Triangles, texturedStates(&texture), 6);
+
+    // Same state throughout, yet nothing merges across the pass boundaries
+    ASSERT_EQ(frame.batches.size(), 3u);
+    ASSERT_EQ(frame.passes.size(), 1u);
+    EXPECT_EQ(frame.passes[0].target, &target);
+    EXPECT_EQ(frame.passes[0].firstBatch, 1u);
+    EXPECT_EQ(frame.passes[0].batchCount, 1u);
+    EXPECT_EQ(frame.batches[1].vertexCount, 12u);
+
+    frame.clear();
+    EXPECT_TRUE(frame.passes.empty());
+}
+
+TEST(RenderFrameTest, DiscardedPassesDropTheirGeometryAndDissolvedOnesKeepIt)
+{
+    sf::Texture       texture;
+    sf::RenderTexture target;
+    RenderFrame       frame;
+
+    frame.append(sf::Triangles, texturedStates(&texture), 6);
+    frame.beginPass(&target, sf::Vector2u(64, 32), sf::View());
+    frame.append(sf::Triangles, texturedStates(&texture), 6);
+    frame.endPass();
+    frame.discardPass();
+
+    EXPECT_TRUE(frame.passes.empty());
+    ASSERT_EQ(frame.batches.size(), 1u);
+    EXPECT_EQ(frame.vertices.size(), 6u);
+
+    frame.beginPass(&target, sf::Vector2u(64, 32), sf::View());
+    frame.append(sf::Triangles, texturedStates(&texture), 6);
+    frame.endPass();
+    frame.dissolvePass();
+    frame.append(sf::Triangles, texturedStates(&texture), 6);
+
+    EXPECT_TRUE(frame.passes.empty());
+    EXPECT_EQ(frame.batches.size(), 3u);
+    EXPECT_EQ(frame.vertices.size(), 18u);
+}
@@ -0,0 +1,243 @@
+#include <gtest/gtest.h>
+
+#include <RenderQueue.h>
+
+#include <limits>
+#include <vector>
+
+using Systems::RenderQueue;
+using Systems::RenderQueueEntry;
+
+namespace
+{
+std::vector<uint32_t> drawOrder(const RenderQueue& queue)
+{
+    std::vector<uint32_t> order;
+    queue.each([&order](const RenderQueueEntry& entry) { order.push_back(entry.entity.index); });
+    return order;
+}
+}  // namespace
+
+TEST(RenderQueueTest, VisitsEntriesInAscendingZ)
+{
+    RenderQueue queue;
+    queue.beginSync();
+    queue.sync(Entity(1), false, 5);
+    queue.sync(Entity(2), false, -3);
+    queue.sync(Entity(3), false, 0);
+    queue.endSync();
+
+    EXPECT_EQ(queue.size(), 3u);
+    EXPECT_EQ(queue.getChangeCount(), 3u);
+    EXPECT_EQ(drawOrder(queue), (std::vector<uint32_t>{2, 3, 1}));
+}
+
+TEST(RenderQueueTest, UnchangedFramesCostNoReordering)
+{
+    RenderQueue queue;
+    queue.beginSync();
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        queue.sync(Entity(i), false, static_cast<int>(i % 4));
+    }
+    queue.endSync();
+
+    queue.beginSync();
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        queue.sync(Entity(i), false, static_cast<int>(i % 4));
+    }
+    queue.endSync();
+    EXPECT_EQ(queue.getChangeCount(), 0u);
+
+    // Only the moved entity is re-bucketed
+    queue.beginSync();
+    for (uint32_t i = 1; i <= 100; ++i)
+    {
+        queue.sync(Entity(i), false, i == 7 ? 10 : static_cast<int>(i % 4));
+    }
+    queue.endSync();
+    EXPECT_EQ(queue.getChangeCount(), 1u);
+    EXPECT_EQ(drawOrder(queue).back(), 7u);
+}
+
+TEST(RenderQueueTest, EntriesNotSyncedArePruned)
+{
+    RenderQueue queue;
+    queue.beginSync();
+    queue.sync(Entity(1), false, 0);
+    queue.sync(Entity(2), false, 0);
+    queue.sync(Entity(2), true, 1);
+    queue.endSync();
+    EXPECT_EQ(queue.size(), 3u);
+
+    queue.beginSync();
+    queue.sync(Entity(2), true, 1);
+    queue.endSync();
+
+    EXPECT_EQ(queue.size(), 1u);
+    EXPECT_EQ(queue.getChangeCount(), 2u);
+
+    int visited = 0;
+    queue.each(
+        [&visited](const RenderQueueEntry& entry)
+        {
+            EXPECT_EQ(entry.entity, Entity(2));
+            EXPECT_TRUE(entry.isParticleEmitter);
+            ++visited;
+        });
+    EXPECT_EQ(visited, 1);
+}
+
+TEST(RenderQueueTest, PruningFollowsEntriesThatMovedThisPass)
+{
+    RenderQueue queue;
+    queue.beginSync();
+    for (uint32_t index = 1; index <= 4; ++index)
+    {
+        queue.sync(Entity(index), false, 0);
+    }
+    queue.endSync();
+
+    // Entity 1 moves to z 1 and entity 2 is gone; only the z 0 bucket lost entries
+    queue.beginSync();
+    queue.sync(Entity(1), false, 1);
+    queue.sync(Entity(3), false, 0);
+    queue.sync(Entity(4), false, 0);
+    queue.endSync();
+    EXPECT_EQ(queue.size(), 3u);
+    EXPECT_EQ(drawOrder(queue), (std::vector<uint32_t>{4, 3, 1}));
+
+    // A re-key after the pass keeps the entry counted as synced
+    queue.setBatchKey(Entity(3), false, 9);
+    queue.beginSync();
+    queue.sync(Entity(1), false, 1);
+    queue.sync(Entity(3), false, 0);
+    queue.sync(Entity(4), false, 0);
+    queue.endSync();
+    EXPECT_EQ(queue.size(), 3u);
+    EXPECT_EQ(queue.getChangeCount(), 0u);
+    EXPECT_EQ(drawOrder(queue), (std::vector<uint32_t>{4, 3, 1}));
+}
+
+TEST(RenderQueueTest, BatchKeysGroupEntriesWithinALayer)
+{
+    RenderQueue queue;
+    queue.beginSync();
+    queue.sync(Entity(1), false, 0);
+    queue.sync(Entity(2), false, 0);
+    queue.sync(Entity(3), false, 0);
+    queue.sync(Entity(4), false, 1);
+    queue.endSync();
+
+    // Texture A, texture B, texture A: the second A moves next to the first
+    queue.setBatchKey(Entity(1), false, 10);
+    queue.setBatchKey(Entity(2), false, 20);
+    queue.setBatchKey(Entity(3), false, 10);
+    queue.setBatchKey(Entity(4), false, 5);
+
+    EXPECT_EQ(drawOrder(queue), (std::vector<uint32_t>{1, 3, 2, 4}));
+
+    // Reporting the same key again is free
+    queue.beginSync();
+    queue.setBatchKey(Entity(3), false, 10);
+    EXPECT_EQ(queue.getChangeCount(), 0u);
+}
+
+TEST(RenderQueueTest, RecycledEntityIndexReplacesTheStaleEntry)
+{
+    RenderQueue queue;
+    queue.beginSync();
+    queue.sync(Entity(1, 0), false, 0);
+    queue.endSync();
+    queue.setBatchKey(Entity(1, 0), false, 42);
+
+    queue.beginSync();
+    queue.sync(Entity(1, 1), false, 0);
+    queue.endSync();
+
+    ASSERT_EQ(queue.size(), 1u);
+    queue.each(
+        [](const RenderQueueEntry& entry)
+        {
+            EXPECT_EQ(entry.entity, Entity(1, 1));
+            EXPECT_EQ(entry.batchKey, 0u);
+        });
+
+    // A stale handle cannot re-key the new entity
+    queue.setBatchKey(Entity(1, 0), false, 7);
+    queue.each([](const RenderQueueEntry& entry) { EXPECT_EQ(entry.batchKey, 0u); });
+}
+
+TEST(RenderQueueTest, RangeVisitsOnlyTheLayersInside)
+{
+    RenderQueue queue;
+    queue.beginSync();
+    for (uint32_t i = 1; i <= 6; ++i)
+    {
+        queue.sync(Entity(i), false, static_cast<int>(i) - 3);  // z from -2 to 3
+    }
+    queue.endSync();
+    queue.setBatchKey(Entity(3), false, std::numeric_limits<uint64_t>::max());
+
+    std::vector<uint32_t> visited;
+    queue.eachInRange(0, 2, [&visited](const RenderQueueEntry& entry) { visited.push_back(entry.entity.index); });
+    EXPECT_EQ(visited, (std::vector<uint32_t>{3, 4, 5}));
+
+    visited.clear();
+    queue.eachInRange(2, 0, [&visited](const RenderQueueEntry& entry) { visited.push_back(entry.entity.index); });
+    EXPECT_TRUE(visited.empty());
+}
+
+TEST(RenderQueueTest, ChangesAreReportedForTheZRangesTheyTouch)
+{
+    RenderQueue queue;
+    queue.beginSync();
+    queue.sync(Entity(1), false, 0);
+    queue.sync(Entity(2), false, 5);
+    queue.endSync();
+    EXPECT_TRUE(queue.changedInRange(0, 0));
+    EXPECT_FALSE(queue.changedInRange(1, 4));
+
+    // Nothing moved: no range changed
+    queue.beginSync();
+    queue.sync(Entity(1), false, 0);
+    queue.sync(Entity(2), false, 5);
+    queue.endSync();
+    EXPECT_FALSE(queue.changedInRange(-100, 100));
+
+    // A move touches both the old and the new z; a removal touches its last z
+    queue.beginSync();
+    queue.sync(Entity(1), false, 3);
+    queue.endSync();
+    EXPECT_EQ(queue.getChangeCount(), 2u);
+    EXPECT_TRUE(queue.changedInRange(0, 0));
+    EXPECT_TRUE(queue.changedInRange(3, 3));
+    EXPECT_TRUE(queue.changedInRange(5, 5));
+    EXPECT_FALSE(queue.changedInRange(1, 2));
+}
+
+TEST(RenderQueueTest, SignatureChangesMarkTheirLayerChanged)
+{
+    RenderQueue queue;
+    queue.beginSync();
+    queue.sync(Entity(1), false, 2, 0xA);
+    queue.sync(Entity(2), false, 7, 0xB);
+    queue.endSync();
+
+    queue.beginSync();
+    queue.sync(Entity(1), false, 2, 0xA);
+    queue.sync(Entity(2), false, 7, 0xB);
+    queue.endSync();
+    EXPECT_FALSE(queue.changedInRange(-100, 100));
+
+    // Entity 1 moved: same bucket, new signature, so only its layer has to be recorded again
+    queue.beginSync();
+    queue.sync(Entity(1), false, 2, 0xC);
+    queue.sync(Entity(2), false, 7, 0xB);
+    queue.endSync();
+    EXPECT_EQ(queue.getChangeCount(), 0u);
+    EXPECT_EQ(drawOrder(queue), (std::vector<uint32_t>{1, 2}));
+    EXPECT_TRUE(queue.changedInRange(0, 4));
+    EXPECT_FALSE(queue.changedInRange(5, 9));
+}
@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+
+#include <World.h>
+#include <systems/ISystem.h>
+#include <systems/JobSystem.h>
+#include <systems/SystemScheduler.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Position
+{
+    float x = 0.0f;
+};
+
+struct Velocity
+{
+    float x = 0.0f;
+};
+
+struct Health
+{
+    int value = 0;
+};
+
+/**
+ * @brief Test system whose access and behaviour are configured per instance
+ */
+class ProbeSystem : public Systems::ISystem
+{
+public:
+    using AccessFn = void (*)(Systems::SystemAccess&);
+
+    ProbeSystem(std::string name, AccessFn access, Systems::UpdateStage stage = Systems::UpdateStage::PreFlush)
+        : m_name(std::move(name)), m_access(access), m_stage(stage)
+    {
+    }
+
+    void update(float /*deltaTime*/, World& /*world*/) override
+    {
+        if (onUpdate)
+        {
+            onUpdate();
+        }
+    }
+
+    Systems::UpdateStage stage() const override
+    {
+        return m_stage;
+    }
+
+    void declareAccess(Systems::SystemAccess& access) const override
+    {
+        if (m_access)
+        {
+            m_access(access);
+        }
+        else
+        {
+            ISystem::declareAccess(access);
+        }
+    }
+
+    const std::string& name() const
+    {
+        return m_name;
+    }
+
+    std::function<void()> onUpdate;
+
+private:
+    std::string          m_name;
+    AccessFn             m_access;
+    Systems::UpdateStage m_stage;
+};
+
+void runAll(Systems::SystemScheduler& scheduler, Systems::JobSystem* jobs, World& world)
+{
+    auto run = [&world](Systems::ISystem& system) { system.update(0.016f, world); };
+    scheduler.runStage(Systems::UpdateStage::PreFlush, jobs, run);
+    scheduler.runStage(Systems::UpdateStage::PostFlush, jobs, run);
+}
+}  // namespace
+
+TEST(SystemSchedulerTest, AccessConflictRules)
+{
+    Systems::SystemAccess readsPosition;
+    readsPosition.reads<Position>();
+    Systems::SystemAccess alsoReadsPosition;
+    alsoReadsPosition.reads<Position, Velocity>();
+    Systems::SystemAccess writesPosition;
+    writesPosition.writes<Position>();
+    Systems::SystemAccess writesHealth;
+    writesHealth.writes<Health>();
+    Systems::SystemAccess exclusive;
+    exclusive.exclusive();
+
+    EXPECT_FALSE(readsPosition.conflictsWith(alsoReadsPosition));
+    EXPECT_TRUE(readsPosition.conflictsWith(writesPosition));
+    EXPECT_TRUE(writesPosition.conflictsWith(readsPosition));
+    EXPECT_TRUE(writesPosition.conflictsWith(writesPosition));
+    EXPECT_FALSE(writesPosition.conflictsWith(writesHealth));
+    EXPECT_TRUE(exclusive.conflictsWith(writesHealth));
+    EXPECT_TRUE(readsPosition.conflictsWith(exclusive));
+}
+
+TEST(SystemSchedulerTest, DependenciesFollowRegistrationOrderOfConflicts)
+{
+    ProbeSystem movement("movement", [](Systems::SystemAccess& a) { a.reads<Velocity>().writes<Position>(); });
+    ProbeSystem health("health", [](Systems::SystemAccess& a) { a.writes<Health>(); });
+    ProbeSystem camera("camera", [](Systems::SystemAccess& a) { a.reads<Position>(); });
+    ProbeSystem legacy("legacy", nullptr);  // declares nothing -> exclusive
+    ProbeSystem late("late", [](Systems::SystemAccess& a) { a.writes<Health>(); }, Systems::UpdateStage::PostFlush);
+
+    Systems::SystemScheduler scheduler;
+    for (auto* system : {&movement, &health, &camera, &legacy, &late})
+    {
+        scheduler.addSystem(system);
+    }
+
+    EXPECT_TRUE(scheduler.getDependencies(&movement).empty());
+    EXPECT_TRUE(scheduler.getDependencies(&health).empty());
+    EXPECT_EQ(scheduler.getDependencies(&camera), (std::vector<size_t>{0}));
+    EXPECT_EQ(scheduler.getDependencies(&legacy), (std::vector<size_t>{0, 1, 2}));
+
+    // PostFlush is a separate graph
+    EXPECT_TRUE(scheduler.getDependencies(&late).empty());
+}
+
+TEST(SystemSchedulerTest, ConflictingSystemsRunInRegistrationOrder)
+{
+    World                    world;
+    Systems::JobSystem       jobs(4);
+    Systems::SystemScheduler scheduler;
+    std::mutex               orderMutex;
+    std::vector<std::string> order;
+
+    std::vector<std::unique_ptr<ProbeSystem>> systems;
+    for (int i = 0; i < 6; ++i)
+    {
+        auto system = std::make_unique<ProbeSystem>("writer" + std::to_string(i),
+                                                    [](Systems::SystemAccess& a) { a.writes<Position>(); });
+        ProbeSystem* raw = system.get();
+        system->onUpdate = [&, raw]()
+        {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(raw->name());
+        };
+        scheduler.addSystem(raw);
+        systems.push_back(std::move(system));
+    }
+
+    runAll(scheduler, &jobs, world);
+
+    ASSERT_EQ(order.size(), 6u);
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_EQ(order[i], "writer" + std::to_string(i));
+    }
+}
+
+TEST(SystemSchedulerTest, IndependentSystemsOverlap)
+{
+    World                    world;
+    Systems::JobSystem       jobs(2);
+    Systems::SystemScheduler scheduler;
+
+    ProbeSystem a("a", [](Systems::SystemAccess& access) { access.writes<Position>(); });
+    ProbeSystem b("b", [](Systems::SystemAccess& access) { access.writes<Health>(); });
+
+    // Each system waits (bounded) for the other to start; this only succeeds if they run concurrently.
+    std::atomic<int>  started{0};
+    std::atomic<bool> overlapped{true};
+    auto              rendezvous = [&]()
+    {
+        started.fetch_add(1);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (started.load() < 2)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                overlapped = false;
+                return;
+            }
+            std::this_thread::yield();
+        }
+    };
+    a.onUpdate = rendezvous;
+    b.onUpdate = rendezvous;
+
+    scheduler.addSystem(&a);
+    scheduler.addSystem(&b);
+    runAll(scheduler, &jobs, world);
+
+    EXPECT_EQ(started.load(), 2);
+    EXPECT_TRUE(overlapped.load());
+}
+
+TEST(SystemSchedulerTest, MainThreadSystemsRunOnCallingThread)
+{
+    World                    world;
+    Systems::JobSystem       jobs(2);
+    Systems::SystemScheduler scheduler;
+    const std::thread::id    mainId = std::this_thread::get_id();
+
+    ProbeSystem pinned("pinned", [](Systems::SystemAccess& a) { a.writes<Position>().mainThread(); });
+    ProbeSystem worker("worker", [](Systems::SystemAccess& a) { a.writes<Health>(); });
+
+    std::thread::id pinnedThread;
+    pinned.onUpdate = [&]() { pinnedThread = std::this_thread::get_id(); };
+    std::atomic<int> workerRuns{0};
+    worker.onUpdate = [&]() { ++workerRuns; };
+
+    scheduler.addSystem(&pinned);
+    scheduler.addSystem(&worker);
+    runAll(scheduler, &jobs, world);
+
+    EXPECT_EQ(pinnedThread, mainId);
+    EXPECT_EQ(workerRuns.load(), 1);
+}
+
+TEST(SystemSchedulerTest, RemovedSystemsStopRunning)
+{
+    World                    world;
+    Systems::SystemScheduler scheduler;
+    ProbeSystem              system("once", nullptr);
+    int                      runs = 0;
+    system.onUpdate               = [&runs]() { ++runs; };
+
+    scheduler.addSystem(&system);
+    runAll(scheduler, nullptr, world);
+    EXPECT_TRUE(scheduler.removeSystem(&system));
+    EXPECT_FALSE(scheduler.removeSystem(&system));
+    runAll(scheduler, nullptr, world);
+
+    EXPECT_EQ(runs, 1);
+}
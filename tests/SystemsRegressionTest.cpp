@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstdint>
+#include <vector>
 #include <World.h>
 
 #include <components/CNativeScript.h>
@@ -200,6 +202,66 @@ TEST(SScriptRegressionTest, SpawningEntitiesWithScriptsDuringOnCreateDoesNotCras
     EXPECT_EQ(updateCount, 1);
 }
 
+namespace
+{
+class TimedScript final : public Components::INativeScript
+{
+public:
+    explicit TimedScript(std::vector<float>* updates) : m_updates(updates) {}
+
+    void onUpdate(float deltaTime, Entity /*self*/, World& /*world*/) override
+    {
+        m_updates->push_back(deltaTime);
+    }
+
+private:
+    std::vector<float>* m_updates;
+};
+}  // namespace
+
+TEST(SScriptTest, UpdateIntervalSpreadsScriptsRoundRobinAndAccumulatesTime)
+{
+    World world;
+
+    constexpr int      kScripts  = 4;
+    constexpr uint32_t kInterval = 4;
+    constexpr float    kDt       = 1.0f / 60.0f;
+
+    std::vector<std::vector<float>> updates(kScripts);
+    for (int i = 0; i < kScripts; ++i)
+    {
+        Entity e      = world.createEntity();
+        auto*  script = world.add<Components::CNativeScript>(e);
+        script->bind<TimedScript>(&updates[i]);
+        script->updateInterval = kInterval;
+    }
+
+    Systems::SScript scripts;
+    for (uint32_t frame = 0; frame < kInterval * 2; ++frame)
+    {
+        size_t updatedBefore = 0;
+        for (const auto& perScript : updates)
+        {
+            updatedBefore += perScript.size();
+        }
+
+        scripts.update(kDt, world);
+
+        size_t updatedAfter = 0;
+        for (const auto& perScript : updates)
+        {
+            updatedAfter += perScript.size();
+        }
+        EXPECT_EQ(updatedAfter - updatedBefore, 1u) << "frame " << frame;
+    }
+
+    for (const auto& perScript : updates)
+    {
+        ASSERT_EQ(perScript.size(), 2u);
+        EXPECT_NEAR(perScript[1], kDt * kInterval, 1e-5f);
+    }
+}
+
 TEST(S2DPhysicsRegressionTest, FixedUpdateCallbackRegisteredBeforeBodyExistsRunsOnceBodyIsCreated)
 {
     World world;
@@ -293,6 +355,12 @@ TEST(ISystemTest, FixedUpdateDefaultCallsUpdate)
     EXPECT_TRUE(system.updateCalled);
 }
 
+TEST(ISystemTest, TickIntervalDefaultIsEveryFrame)
+{
+    TestSystem system;
+    EXPECT_FLOAT_EQ(system.tickInterval(), 0.0f);
+}
+
 TEST(ISystemTest, StageDefaultReturnsPreFlush)
 {
     TestSystem system;
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <TextureAtlas.h>
+
+#include <vector>
+
+using Systems::SkylinePacker;
+
+namespace
+{
+struct Placed
+{
+    unsigned x, y, w, h;
+};
+
+bool overlaps(const Placed& a, const Placed& b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+}  // namespace
+
+TEST(TextureAtlasTest, PackedRectanglesStayInsideAndNeverOverlap)
+{
+    SkylinePacker       packer(256, 256);
+    std::vector<Placed> placed;
+
+    // Mixed sizes arriving in no particular order
+    const unsigned sizes[][2] = {{32, 48}, {64, 16}, {16, 16}, {100, 30}, {8, 90}, {50, 50}, {33, 17}, {70, 70}};
+    for (int round = 0; round < 3; ++round)
+    {
+        for (const auto& size : sizes)
+        {
+            unsigned x = 0;
+            unsigned y = 0;
+            if (!packer.pack(size[0], size[1], x, y))
+            {
+                continue;
+            }
+            const Placed rect{x, y, size[0], size[1]};
+            EXPECT_LE(rect.x + rect.w, 256u);
+            EXPECT_LE(rect.y + rect.h, 256u);
+            for (const Placed& other : placed)
+            {
+                EXPECT_FALSE(overlaps(rect, other));
+            }
+            placed.push_back(rect);
+        }
+    }
+
+    EXPECT_GE(placed.size(), 16u);
+}
+
+TEST(TextureAtlasTest, FailsOnceThePageIsFull)
+{
+    SkylinePacker packer(64, 64);
+    unsigned      x = 0;
+    unsigned      y = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        ASSERT_TRUE(packer.pack(16, 16, x, y));
+    }
+
+    EXPECT_FLOAT_EQ(packer.getOccupancy(), 1.0f);
+    EXPECT_FALSE(packer.pack(1, 1, x, y));
+    EXPECT_FALSE(SkylinePacker(64, 64).pack(65, 8, x, y));
+}
+
+TEST(TextureAtlasTest, FillsTheLowestGapFirst)
+{
+    SkylinePacker packer(100, 100);
+    unsigned      x = 0;
+    unsigned      y = 0;
+
+    ASSERT_TRUE(packer.pack(60, 40, x, y));
+    EXPECT_EQ(x, 0u);
+    EXPECT_EQ(y, 0u);
+
+    // Lands beside the first rectangle rather than on top of it
+    ASSERT_TRUE(packer.pack(40, 10, x, y));
+    EXPECT_EQ(x, 60u);
+    EXPECT_EQ(y, 0u);
+
+    // Too wide for the gap beside it: goes on the lower skyline spanning both
+    ASSERT_TRUE(packer.pack(50, 10, x, y));
+    EXPECT_EQ(y, 40u);
+
+    EXPECT_NEAR(packer.getOccupancy(), (60.0f * 40 + 40 * 10 + 50 * 10) / 10000.0f, 1e-6f);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <JobSystem.h>
+#include <TextureStreamer.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <thread>
+
+using Systems::JobCounter;
+using Systems::JobSystem;
+using Systems::TextureAtlas;
+using Systems::TextureRegion;
+using Systems::TextureStreamer;
+
+// Only missing files are used: decoding them fails without ever needing a GPU context
+
+TEST(TextureStreamerTest, RequestsAreDeduplicatedUntilUploaded)
+{
+    TextureAtlas    atlas;
+    TextureStreamer streamer(atlas);
+
+    const AssetHandle handle = AssetHandles::intern("streamer/missing_a.png");
+    EXPECT_TRUE(streamer.request(handle, "streamer/missing_a.png", nullptr));
+    EXPECT_FALSE(streamer.request(handle, "streamer/missing_a.png", nullptr));
+    EXPECT_EQ(streamer.getPendingCount(), 1u);
+
+    std::map<AssetHandle, int> reported;
+    streamer.upload(2.0f,
+                    [&reported](AssetHandle finished, const TextureRegion* region)
+                    {
+                        EXPECT_EQ(region, nullptr);
+                        ++reported[finished];
+                    });
+
+    EXPECT_EQ(reported.size(), 1u);
+    EXPECT_EQ(reported[handle], 1);
+    EXPECT_EQ(streamer.getPendingCount(), 0u);
+    EXPECT_EQ(atlas.getRegionCount(), 0u);
+}
+
+TEST(TextureStreamerTest, UploadsAtLeastOneImagePerCall)
+{
+    TextureAtlas    atlas;
+    TextureStreamer streamer(atlas);
+    for (const char* path : {"streamer/missing_b.png", "streamer/missing_c.png", "streamer/missing_d.png"})
+    {
+        streamer.request(AssetHandles::intern(path), path, nullptr);
+    }
+
+    auto ignore = [](AssetHandle, const TextureRegion*) {};
+    EXPECT_EQ(streamer.upload(0.0f, ignore), 1u);
+    EXPECT_EQ(streamer.upload(0.0f, ignore), 1u);
+    EXPECT_EQ(streamer.getPendingCount(), 1u);
+    EXPECT_EQ(streamer.upload(0.0f, ignore), 1u);
+    EXPECT_EQ(streamer.upload(0.0f, ignore), 0u);
+}
+
+TEST(TextureStreamerTest, DecodesOnJobWorkers)
+{
+    JobSystem       jobs(2);
+    TextureAtlas    atlas;
+    TextureStreamer streamer(atlas);
+
+    const std::string paths[] = {"streamer/missing_e.png", "streamer/missing_f.png", "streamer/missing_g.png"};
+    for (const std::string& path : paths)
+    {
+        EXPECT_TRUE(streamer.request(AssetHandles::intern(path), path, &jobs));
+    }
+
+    std::map<AssetHandle, int> reported;
+    const auto                 deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (reported.size() < 3 && std::chrono::steady_clock::now() < deadline)
+    {
+        streamer.upload(2.0f, [&reported](AssetHandle handle, const TextureRegion*) { ++reported[handle]; });
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(reported.size(), 3u);
+    for (const std::string& path : paths)
+    {
+        EXPECT_EQ(reported[AssetHandles::intern(path)], 1);
+    }
+    EXPECT_EQ(streamer.getPendingCount(), 0u);
+}
+
+TEST(TextureStreamerTest, LoadsDuringAnInFlightFrameLeaveTheAtlasAlone)
+{
+    // A file that decodes; it is never uploaded, so still no GPU context is needed
+    const std::string path = ::testing::TempDir() + "texture_streamer_in_flight.png";
+    sf::Image         image;
+    image.create(4, 4, sf::Color::Red);
+    ASSERT_TRUE(image.saveToFile(path));
+
+    JobSystem       jobs(1);
+    TextureAtlas    atlas;
+    TextureStreamer streamer(atlas);
+
+    // Stands in for the render job sampling atlas pages while the next frame is recorded
+    std::atomic<bool>   frameDone{false};
+    std::atomic<size_t> regionsSeen{0};
+    JobCounter          frame;
+    jobs.schedule(
+        [&]()
+        {
+            while (!frameDone)
+            {
+                std::this_thread::yield();
+            }
+            regionsSeen = atlas.getRegionCount();
+        },
+        &frame);
+
+    // Decoded on the recording thread, as SRenderer does with async loading off
+    const AssetHandle handle = AssetHandles::intern(path);
+    EXPECT_TRUE(streamer.request(handle, path, nullptr));
+    EXPECT_EQ(atlas.find(path), nullptr);
+    EXPECT_EQ(atlas.getRegionCount(), 0u);
+
+    frameDone = true;
+    jobs.wait(frame);
+    EXPECT_EQ(regionsSeen, 0u);
+    EXPECT_EQ(streamer.getPendingCount(), 1u);
+
+    std::remove(path.c_str());
+}
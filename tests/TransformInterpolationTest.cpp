@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <components/CTransform.h>
+
+#include <cmath>
+
+using Components::CTransform;
+
+TEST(TransformInterpolationTest, UninterpolatedTransformReturnsCurrentPose)
+{
+    CTransform transform(Vec2(1.0f, 2.0f), Vec2(1.0f, 1.0f), 0.5f);
+    transform.position = Vec2(3.0f, 4.0f);
+
+    Vec2 pos = transform.getInterpolatedPosition(0.0f);
+    EXPECT_FLOAT_EQ(pos.x, 3.0f);
+    EXPECT_FLOAT_EQ(pos.y, 4.0f);
+    EXPECT_FLOAT_EQ(transform.getInterpolatedRotation(0.0f), 0.5f);
+}
+
+TEST(TransformInterpolationTest, SnapshotBlendsBetweenFixedSteps)
+{
+    CTransform transform;
+    transform.snapshot();
+    transform.position = Vec2(10.0f, -4.0f);
+    transform.rotation = 1.0f;
+
+    Vec2 half = transform.getInterpolatedPosition(0.5f);
+    EXPECT_FLOAT_EQ(half.x, 5.0f);
+    EXPECT_FLOAT_EQ(half.y, -2.0f);
+    EXPECT_FLOAT_EQ(transform.getInterpolatedRotation(0.25f), 0.25f);
+
+    Vec2 current = transform.getInterpolatedPosition(1.0f);
+    EXPECT_FLOAT_EQ(current.x, 10.0f);
+    EXPECT_FLOAT_EQ(current.y, -4.0f);
+}
+
+TEST(TransformInterpolationTest, RotationTakesShortestArcAcrossWrap)
+{
+    const float pi = 3.14159265f;
+
+    CTransform transform;
+    transform.rotation = pi - 0.1f;
+    transform.snapshot();
+    transform.rotation = -pi + 0.1f;  // Box2D wrapped the angle; the body turned 0.2 rad
+
+    float mid = transform.getInterpolatedRotation(0.5f);
+    EXPECT_NEAR(std::remainder(mid - pi, 2.0f * pi), 0.0f, 1e-4f);
+}
+
+TEST(TransformInterpolationTest, SettersSnapBothPoses)
+{
+    CTransform transform;
+    transform.snapshot();
+    transform.position = Vec2(5.0f, 5.0f);
+
+    transform.setPosition(Vec2(100.0f, 0.0f));
+    transform.setRotation(2.0f);
+
+    Vec2 pos = transform.getInterpolatedPosition(0.0f);
+    EXPECT_FLOAT_EQ(pos.x, 100.0f);
+    EXPECT_FLOAT_EQ(pos.y, 0.0f);
+    EXPECT_FLOAT_EQ(transform.getInterpolatedRotation(0.0f), 2.0f);
+}